@@ -0,0 +1,94 @@
+#include "BenchCommon.hpp"
+
+#include <any>
+#include <string>
+
+using namespace CQueBench;
+
+// CQue::Any against std::any, with a value small enough to be stored inline by both and one which neither stores inline
+
+using SmallValue = std::int64_t;
+using LargeValue = Blob<64>;
+
+template <class T>
+static T MakeValue() { return T(42); }
+
+template <class _Any>
+struct AnyOps;
+
+template <>
+struct AnyOps<CQue::Any>
+{
+	template <class T>
+	static const T& Cast(const CQue::Any& any) { return any.GetValue<T>(); }
+};
+
+template <>
+struct AnyOps<std::any>
+{
+	template <class T>
+	static const T& Cast(const std::any& any) { return *std::any_cast<T>(&any); }
+};
+
+template <class _Any, class T>
+static void BM_AnyConstruct(benchmark::State& state)
+{
+	const T value = MakeValue<T>();
+
+	for (auto _ : state)
+	{
+		_Any any(value);
+		benchmark::DoNotOptimize(&any);
+	}
+}
+
+template <class _Any, class T>
+static void BM_AnyCopy(benchmark::State& state)
+{
+	const _Any source(MakeValue<T>());
+
+	for (auto _ : state)
+	{
+		_Any any(source);
+		benchmark::DoNotOptimize(&any);
+	}
+}
+
+// Assigning alternates between two types, so that every assignment destroys the old value and creates a new one
+template <class _Any, class T>
+static void BM_AnyAssign(benchmark::State& state)
+{
+	const T value = MakeValue<T>();
+	const std::int32_t other = 7;
+	_Any any;
+
+	for (auto _ : state)
+	{
+		any = value;
+		benchmark::DoNotOptimize(&any);
+		any = other;
+		benchmark::DoNotOptimize(&any);
+	}
+
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+
+template <class _Any, class T>
+static void BM_AnyCast(benchmark::State& state)
+{
+	const _Any any(MakeValue<T>());
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(AnyOps<_Any>::template Cast<T>(any));
+}
+
+#define CQUE_BENCH_ANY(_Bench)                                \
+	BENCHMARK_TEMPLATE(_Bench, CQue::Any, SmallValue);        \
+	BENCHMARK_TEMPLATE(_Bench, std::any, SmallValue);         \
+	BENCHMARK_TEMPLATE(_Bench, CQue::Any, LargeValue);        \
+	BENCHMARK_TEMPLATE(_Bench, std::any, LargeValue);
+
+CQUE_BENCH_ANY(BM_AnyConstruct)
+CQUE_BENCH_ANY(BM_AnyCopy)
+CQUE_BENCH_ANY(BM_AnyAssign)
+CQUE_BENCH_ANY(BM_AnyCast)
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "CQue.hpp"
+
+namespace CQueBench
+{
+	// Item of N bytes, for telling how the cost of moving items scales with their size
+	template <std::size_t N>
+	struct Blob
+	{
+		static_assert(N % sizeof(std::uint64_t) == 0);
+
+		std::array<std::uint64_t, N / sizeof(std::uint64_t)> Words{};
+
+		Blob() = default;
+		explicit Blob(std::uint64_t seed) noexcept { Words.fill(seed); }
+	};
+
+	// The CQue containers and their standard counterparts are driven through the same few calls
+
+	template <class T, class A, class G>
+	void PushBack(CQue::List<T, A, G>& list, const T& what) { list.Add(what); }
+
+	template <class T>
+	void PushBack(std::vector<T>& list, const T& what) { list.push_back(what); }
+
+	template <class T, class A, class G>
+	void InsertAt(CQue::List<T, A, G>& list, std::size_t index, const T& what) { list.Insert(index, what); }
+
+	template <class T>
+	void InsertAt(std::vector<T>& list, std::size_t index, const T& what) { list.insert(list.begin() + index, what); }
+
+	template <class T, class A, class G>
+	void EraseAt(CQue::List<T, A, G>& list, std::size_t index) { list.RemoveAt(index); }
+
+	template <class T>
+	void EraseAt(std::vector<T>& list, std::size_t index) { list.erase(list.begin() + index); }
+
+	template <class T, class A, class G, class _Source>
+	void Append(CQue::List<T, A, G>& list, const _Source& items) { list.AddRange(items); }
+
+	template <class T, class _Source>
+	void Append(std::vector<T>& list, const _Source& items) { list.insert(list.end(), items.begin(), items.end()); }
+
+	enum class Order
+	{
+		Random,
+		Sorted,
+		Reversed,
+	};
+
+	/// @brief Values 0 to count - 1 in the given order, always the same for the same arguments.
+	template <class _Container>
+	_Container MakeSequence(std::size_t count, Order order)
+	{
+		_Container out;
+		for (std::size_t i = 0; i < count; i++)
+			PushBack(out, static_cast<std::decay_t<decltype(*out.begin())>>(order == Order::Reversed ? count - 1 - i : i));
+
+		if (order == Order::Random)
+			std::shuffle(out.begin(), out.end(), std::mt19937_64(count));
+
+		return out;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "BenchCommon.hpp"
+
+using namespace CQueBench;
+
+// Every benchmark runs on CQue::List and on std::vector with the same items, the latter serving as the baseline
+
+template <class _Container>
+static void BM_Add(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		_Container list;
+		for (std::size_t i = 0; i < count; i++)
+			PushBack(list, T(i));
+
+		benchmark::DoNotOptimize(list.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+// Inserting at the front shifts every item, so this measures the cost of moving items rather than of growing
+template <class _Container>
+static void BM_InsertFront(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		_Container list;
+		for (std::size_t i = 0; i < count; i++)
+			InsertAt(list, 0, T(i));
+
+		benchmark::DoNotOptimize(list.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class _Container>
+static void BM_RemoveAtFront(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+	_Container full;
+	for (std::size_t i = 0; i < count; i++)
+		PushBack(full, T(i));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		_Container list = full;
+		state.ResumeTiming();
+
+		for (std::size_t i = 0; i < count; i++)
+			EraseAt(list, 0);
+
+		benchmark::DoNotOptimize(list.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class _Container>
+static void BM_AddRange(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+	_Container chunk;
+	for (std::size_t i = 0; i < 64; i++)
+		PushBack(chunk, T(i));
+
+	for (auto _ : state)
+	{
+		_Container list;
+		for (std::size_t i = 0; i < count; i += 64)
+			Append(list, chunk);
+
+		benchmark::DoNotOptimize(list.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+#define CQUE_BENCH_SIZES(_Bench, _Item, _First, _Last)                                                        \
+	BENCHMARK_TEMPLATE(_Bench, CQue::List<_Item>)->RangeMultiplier(8)->Range(_First, _Last);                  \
+	BENCHMARK_TEMPLATE(_Bench, std::vector<_Item>)->RangeMultiplier(8)->Range(_First, _Last);
+
+CQUE_BENCH_SIZES(BM_Add, Blob<8>, 64, 1 << 18)
+CQUE_BENCH_SIZES(BM_Add, Blob<64>, 64, 1 << 18)
+CQUE_BENCH_SIZES(BM_Add, Blob<256>, 64, 1 << 15)
+
+CQUE_BENCH_SIZES(BM_InsertFront, Blob<8>, 64, 1 << 12)
+CQUE_BENCH_SIZES(BM_InsertFront, Blob<64>, 64, 1 << 12)
+CQUE_BENCH_SIZES(BM_InsertFront, Blob<256>, 64, 1 << 12)
+
+CQUE_BENCH_SIZES(BM_RemoveAtFront, Blob<8>, 64, 1 << 12)
+CQUE_BENCH_SIZES(BM_RemoveAtFront, Blob<64>, 64, 1 << 12)
+CQUE_BENCH_SIZES(BM_RemoveAtFront, Blob<256>, 64, 1 << 12)
+
+CQUE_BENCH_SIZES(BM_AddRange, Blob<8>, 64, 1 << 18)
+CQUE_BENCH_SIZES(BM_AddRange, Blob<64>, 64, 1 << 18)
+CQUE_BENCH_SIZES(BM_AddRange, Blob<256>, 64, 1 << 15)
\ No newline at end of file
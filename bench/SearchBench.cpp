@@ -0,0 +1,77 @@
+#include "BenchCommon.hpp"
+
+using namespace CQueBench;
+
+// The item searched for is in last place, so every scan walks the whole container
+
+template <class _Container>
+static void BM_IndexOf(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const _Container list = MakeSequence<_Container>(count, Order::Sorted);
+	const T last = T(count - 1);
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(CQue::Container::IndexOf(list, last));
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <class _Container>
+static void BM_StdFind(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const _Container list = MakeSequence<_Container>(count, Order::Sorted);
+	const T last = T(count - 1);
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(std::find(list.begin(), list.end(), last));
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+// About one item in eight matches
+template <class _Container>
+static void BM_FindAll(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const _Container list = MakeSequence<_Container>(static_cast<std::size_t>(state.range(0)), Order::Random);
+
+	for (auto _ : state)
+	{
+		_Container found = CQue::Container::FindAll<T>(list, [](const T& what) { return (static_cast<std::int64_t>(what) & 7) == 0; });
+		benchmark::DoNotOptimize(found.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class _Container>
+static void BM_StdCopyIf(benchmark::State& state)
+{
+	using T = typename std::decay_t<decltype(*std::declval<_Container>().begin())>;
+	const _Container list = MakeSequence<_Container>(static_cast<std::size_t>(state.range(0)), Order::Random);
+
+	for (auto _ : state)
+	{
+		_Container found;
+		std::copy_if(list.begin(), list.end(), std::back_inserter(found), [](const T& what) { return (static_cast<std::int64_t>(what) & 7) == 0; });
+		benchmark::DoNotOptimize(found.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define CQUE_BENCH_SCANS(_Item)                                                                        \
+	BENCHMARK_TEMPLATE(BM_IndexOf, CQue::List<_Item>)->RangeMultiplier(16)->Range(1 << 8, 1 << 22);    \
+	BENCHMARK_TEMPLATE(BM_StdFind, std::vector<_Item>)->RangeMultiplier(16)->Range(1 << 8, 1 << 22);   \
+	BENCHMARK_TEMPLATE(BM_FindAll, CQue::List<_Item>)->RangeMultiplier(16)->Range(1 << 8, 1 << 22);    \
+	BENCHMARK_TEMPLATE(BM_StdCopyIf, std::vector<_Item>)->RangeMultiplier(16)->Range(1 << 8, 1 << 22);
+
+CQUE_BENCH_SCANS(std::int32_t)
+CQUE_BENCH_SCANS(std::int64_t)
+CQUE_BENCH_SCANS(double)
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "BenchCommon.hpp"
+
+#include <string>
+
+using namespace CQueBench;
+
+// Sorting starts over from a fresh copy of the same input every iteration; the copy is not timed
+
+template <class _Container, Order _Order>
+static void BM_ListSort(benchmark::State& state)
+{
+	const _Container input = MakeSequence<_Container>(static_cast<std::size_t>(state.range(0)), _Order);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		_Container list = input;
+		state.ResumeTiming();
+
+		list.Sort();
+		benchmark::DoNotOptimize(list.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class _Container, Order _Order>
+static void BM_ContainerSort(benchmark::State& state)
+{
+	const _Container input = MakeSequence<_Container>(static_cast<std::size_t>(state.range(0)), _Order);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		_Container list = input;
+		state.ResumeTiming();
+
+		CQue::Container::Sort(list);
+		benchmark::DoNotOptimize(list.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class _Container, Order _Order>
+static void BM_StdSort(benchmark::State& state)
+{
+	const _Container input = MakeSequence<_Container>(static_cast<std::size_t>(state.range(0)), _Order);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		_Container list = input;
+		state.ResumeTiming();
+
+		std::sort(list.begin(), list.end());
+		benchmark::DoNotOptimize(list.begin());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Sorts by a key which is not arithmetic, so that the branchless partitioning does not apply
+struct Labelled
+{
+	std::uint64_t Key = 0;
+	std::string Label;
+
+	Labelled() = default;
+	explicit Labelled(std::size_t key) : Key(key), Label("item") {}
+
+	bool operator<(const Labelled& other) const noexcept { return Key < other.Key; }
+	bool operator==(const Labelled& other) const noexcept { return Key == other.Key; }
+};
+
+#define CQUE_BENCH_ORDERS(_Item)                                                                                                      \
+	BENCHMARK_TEMPLATE(BM_ListSort, CQue::List<_Item>, Order::Random)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);                  \
+	BENCHMARK_TEMPLATE(BM_ListSort, CQue::List<_Item>, Order::Sorted)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);                  \
+	BENCHMARK_TEMPLATE(BM_ListSort, CQue::List<_Item>, Order::Reversed)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);                \
+	BENCHMARK_TEMPLATE(BM_ContainerSort, std::vector<_Item>, Order::Random)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);            \
+	BENCHMARK_TEMPLATE(BM_ContainerSort, std::vector<_Item>, Order::Sorted)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);            \
+	BENCHMARK_TEMPLATE(BM_ContainerSort, std::vector<_Item>, Order::Reversed)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);          \
+	BENCHMARK_TEMPLATE(BM_StdSort, std::vector<_Item>, Order::Random)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);                  \
+	BENCHMARK_TEMPLATE(BM_StdSort, std::vector<_Item>, Order::Sorted)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);                  \
+	BENCHMARK_TEMPLATE(BM_StdSort, std::vector<_Item>, Order::Reversed)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+CQUE_BENCH_ORDERS(std::int64_t)
+CQUE_BENCH_ORDERS(double)
+CQUE_BENCH_ORDERS(Labelled)
\ No newline at end of file
@@ -0,0 +1,405 @@
+#pragma once
+
+#include "base_include.hpp"
+
+#include <limits>
+#include <memory_resource>
+
+namespace CQue
+{
+	// ####################################### FORWARD DECLARATIONS #######################################
+
+	/// @brief Bump-pointer memory resource. Allocating advances a cursor through the current chunk, deallocating does nothing,
+	/// and everything is reclaimed at once by Reset() or destruction. Not thread-safe.
+	class MonotonicArena : public std::pmr::memory_resource
+	{
+	public:
+		explicit MonotonicArena(std::size_t chunk_size = 4096, std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+
+		/// @brief Starts out in the given buffer, which the arena does not own, before turning to the upstream resource.
+		MonotonicArena(void* buffer, std::size_t size, std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+
+		MonotonicArena(const MonotonicArena&) = delete;
+		MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+		void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+		/// @brief Number of bytes handed out since construction or the last Reset(), alignment padding included.
+		std::size_t BytesUsed() const noexcept;
+
+		/// @brief Gives every chunk back to the upstream resource.
+		void Release() noexcept;
+
+		/// @brief Rewinds the arena for reuse. The largest chunk is kept so that an arena reused for similar workloads stops
+		/// requesting memory from upstream after the first round.
+		void Reset() noexcept;
+
+		std::pmr::memory_resource* Upstream() const noexcept;
+
+		~MonotonicArena() override;
+
+	protected:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+		void do_deallocate(void* where, std::size_t bytes, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	private:
+		// Placed at the start of each chunk obtained from upstream
+		struct _Chunk
+		{
+			_Chunk* Next;
+			std::size_t Size;
+		};
+
+		void* _AllocateSlow(std::size_t bytes, std::size_t alignment);
+
+		std::pmr::memory_resource* _ptrUpstream;
+		_Chunk* _Chunks;
+		unsigned char* _Begin;
+		unsigned char* _Cursor;
+		unsigned char* _End;
+		unsigned char* _InitialBuffer;
+		std::size_t _InitialSize;
+		std::size_t _ChunkSize;
+		std::size_t _NextChunkSize;
+		std::size_t _UsedBefore;
+	};
+
+	/// @brief Memory resource handing out blocks of a single size from a free list. Blocks are carved out of chunks requested
+	/// from the upstream resource, recycled on deallocation, and only given back upstream by Release() or destruction. Requests
+	/// which do not fit in a block are forwarded to the upstream resource. Not thread-safe.
+	class FixedPool : public std::pmr::memory_resource
+	{
+	public:
+		explicit FixedPool(std::size_t block_size, std::size_t blocks_per_chunk = 64, std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+
+		FixedPool(const FixedPool&) = delete;
+		FixedPool& operator=(const FixedPool&) = delete;
+
+		void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+		void Deallocate(void* where, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+		std::size_t BlockSize() const noexcept;
+		std::size_t BlockAlignment() const noexcept;
+
+		/// @brief Gives every chunk back to the upstream resource. Blocks handed out so far must no longer be used.
+		void Release() noexcept;
+
+		std::pmr::memory_resource* Upstream() const noexcept;
+
+		~FixedPool() override;
+
+	protected:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+		void do_deallocate(void* where, std::size_t bytes, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	private:
+		struct _FreeBlock
+		{
+			_FreeBlock* Next;
+		};
+
+		struct _Chunk
+		{
+			_Chunk* Next;
+		};
+
+		bool _Fits(std::size_t bytes, std::size_t alignment) const noexcept;
+		void _Refill();
+
+		std::pmr::memory_resource* _ptrUpstream;
+		_FreeBlock* _Free;
+		_Chunk* _Chunks;
+		std::size_t _BlockSize;
+		std::size_t _BlockAlignment;
+		std::size_t _BlocksPerChunk;
+	};
+
+	/// @brief Allocator drawing from a MonotonicArena. Deallocation is a no-op; the memory is reclaimed with the arena.
+	/// @tparam T Type of objects to allocate
+	template <class T>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = T;
+
+		constexpr ArenaAllocator(MonotonicArena& arena) noexcept;
+
+		template <class U>
+		constexpr ArenaAllocator(const ArenaAllocator<U>& other) noexcept;
+
+		T* allocate(std::size_t n);
+		void deallocate(T* where, std::size_t n) noexcept;
+
+		constexpr MonotonicArena& Arena() const noexcept;
+
+	private:
+		MonotonicArena* _ptrArena;
+	};
+
+	/// @brief Allocator drawing from a FixedPool. Allocations larger than the pool's blocks are passed on to its upstream resource.
+	/// @tparam T Type of objects to allocate
+	template <class T>
+	class PoolAllocator
+	{
+	public:
+		using value_type = T;
+
+		constexpr PoolAllocator(FixedPool& pool) noexcept;
+
+		template <class U>
+		constexpr PoolAllocator(const PoolAllocator<U>& other) noexcept;
+
+		T* allocate(std::size_t n);
+		void deallocate(T* where, std::size_t n) noexcept;
+
+		constexpr FixedPool& Pool() const noexcept;
+
+	private:
+		FixedPool* _ptrPool;
+	};
+
+	/// @brief Size of the pages in which the operating system hands out virtual memory.
+	std::size_t SystemPageSize() noexcept;
+
+	// Page-granular virtual memory behind PageAllocator<T>. Reserved ranges are inaccessible until committed; committing and
+	// releasing round to whole pages.
+
+	void* _ReservePages(std::size_t bytes);
+	bool _CommitPages(void* where, std::size_t bytes) noexcept;
+	void _ReleasePages(void* where, std::size_t bytes) noexcept;
+
+	/// @brief Allocator reserving a fixed range of virtual memory for every block and committing pages of it as the block is
+	/// expanded, so that a container can grow to the reservation without moving its items or holding two copies of them at
+	/// once. Ranges of 2 MiB or more are advised to be backed by transparent huge pages where the system supports them.
+	/// @tparam T Type of objects to allocate
+	template <class T>
+	class PageAllocator
+	{
+	public:
+		using value_type = T;
+
+		/// @brief 64 GiB on 64-bit targets, 256 MiB otherwise. Reserving costs address space only.
+		static constexpr std::size_t DefaultReservation = (sizeof(void*) >= 8) ? (std::size_t(1) << 36) : (std::size_t(1) << 28);
+
+		/// @brief Blocks larger than the reservation get a range of their own size, which they cannot expand past.
+		constexpr explicit PageAllocator(std::size_t reservation = DefaultReservation) noexcept;
+
+		template <class U>
+		constexpr PageAllocator(const PageAllocator<U>& other) noexcept;
+
+		T* allocate(std::size_t n);
+		void deallocate(T* where, std::size_t n) noexcept;
+
+		/// @brief Commits enough of the block's range for new_n items. Fails once that would exceed the range.
+		bool TryExpand(T* where, std::size_t n, std::size_t new_n) noexcept;
+
+		constexpr std::size_t Reservation() const noexcept;
+
+	private:
+		std::size_t _RangeFor(std::size_t n) const noexcept;
+
+		std::size_t _Reservation;
+	};
+
+	template <class T, class U>
+	constexpr bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept
+	{
+		return (&a.Arena() == &b.Arena());
+	}
+
+	template <class T, class U>
+	constexpr bool operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b) noexcept
+	{
+		return (&a.Pool() == &b.Pool());
+	}
+
+	template <class T, class U>
+	constexpr bool operator==(const PageAllocator<T>& a, const PageAllocator<U>& b) noexcept
+	{
+		return (a.Reservation() == b.Reservation());
+	}
+
+	// ######################################## BODY DECLARATIONS #########################################
+
+	// ****************************************** MonotonicArena ******************************************
+
+	inline void* MonotonicArena::Allocate(std::size_t bytes, std::size_t alignment)
+	{
+		void* where = _Cursor;
+		std::size_t space = static_cast<std::size_t>(_End - _Cursor);
+
+		if (_Cursor && std::align(alignment, bytes, where, space))
+		{
+			_Cursor = static_cast<unsigned char*>(where) + bytes;
+			return where;
+		}
+		else
+			return _AllocateSlow(bytes, alignment);
+	}
+
+	inline std::pmr::memory_resource* MonotonicArena::Upstream() const noexcept
+	{
+		return _ptrUpstream;
+	}
+
+	// ******************************************** FixedPool *********************************************
+
+	inline void* FixedPool::Allocate(std::size_t bytes, std::size_t alignment)
+	{
+		if (!_Fits(bytes, alignment))
+			return _ptrUpstream->allocate(bytes, alignment);
+
+		if (!_Free)
+			_Refill();
+
+		return std::exchange(_Free, _Free->Next);
+	}
+
+	inline void FixedPool::Deallocate(void* where, std::size_t bytes, std::size_t alignment) noexcept
+	{
+		if (!_Fits(bytes, alignment))
+			_ptrUpstream->deallocate(where, bytes, alignment);
+		else
+			_Free = ::new (where) _FreeBlock{ _Free };
+	}
+
+	inline std::size_t FixedPool::BlockSize() const noexcept
+	{
+		return _BlockSize;
+	}
+
+	inline std::size_t FixedPool::BlockAlignment() const noexcept
+	{
+		return _BlockAlignment;
+	}
+
+	inline std::pmr::memory_resource* FixedPool::Upstream() const noexcept
+	{
+		return _ptrUpstream;
+	}
+
+	inline bool FixedPool::_Fits(std::size_t bytes, std::size_t alignment) const noexcept
+	{
+		return (bytes <= _BlockSize && alignment <= _BlockAlignment);
+	}
+
+	// **************************************** ArenaAllocator<T> *****************************************
+
+	template <class T>
+	constexpr ArenaAllocator<T>::ArenaAllocator(MonotonicArena& arena) noexcept : _ptrArena(&arena) {}
+
+	template <class T>
+	template <class U>
+	constexpr ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& other) noexcept : _ptrArena(&other.Arena()) {}
+
+	template <class T>
+	T* ArenaAllocator<T>::allocate(std::size_t n)
+	{
+		if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			throw std::bad_array_new_length();
+
+		return static_cast<T*>(_ptrArena->Allocate(n * sizeof(T), alignof(T)));
+	}
+
+	template <class T>
+	void ArenaAllocator<T>::deallocate(T*, std::size_t) noexcept {}
+
+	template <class T>
+	constexpr MonotonicArena& ArenaAllocator<T>::Arena() const noexcept
+	{
+		return *_ptrArena;
+	}
+
+	// ***************************************** PoolAllocator<T> *****************************************
+
+	template <class T>
+	constexpr PoolAllocator<T>::PoolAllocator(FixedPool& pool) noexcept : _ptrPool(&pool) {}
+
+	template <class T>
+	template <class U>
+	constexpr PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& other) noexcept : _ptrPool(&other.Pool()) {}
+
+	template <class T>
+	T* PoolAllocator<T>::allocate(std::size_t n)
+	{
+		if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			throw std::bad_array_new_length();
+
+		return static_cast<T*>(_ptrPool->Allocate(n * sizeof(T), alignof(T)));
+	}
+
+	template <class T>
+	void PoolAllocator<T>::deallocate(T* where, std::size_t n) noexcept
+	{
+		_ptrPool->Deallocate(where, n * sizeof(T), alignof(T));
+	}
+
+	template <class T>
+	constexpr FixedPool& PoolAllocator<T>::Pool() const noexcept
+	{
+		return *_ptrPool;
+	}
+
+	// ***************************************** PageAllocator<T> *****************************************
+
+	template <class T>
+	constexpr PageAllocator<T>::PageAllocator(std::size_t reservation) noexcept : _Reservation(reservation) {}
+
+	template <class T>
+	template <class U>
+	constexpr PageAllocator<T>::PageAllocator(const PageAllocator<U>& other) noexcept : _Reservation(other.Reservation()) {}
+
+	template <class T>
+	T* PageAllocator<T>::allocate(std::size_t n)
+	{
+		if (n > (std::numeric_limits<std::size_t>::max() - SystemPageSize()) / sizeof(T))
+			throw std::bad_array_new_length();
+
+		std::size_t range = _RangeFor(n);
+		void* where = _ReservePages(range);
+
+		if (!_CommitPages(where, n * sizeof(T)))
+		{
+			_ReleasePages(where, range);
+			throw std::bad_alloc();
+		}
+
+		return static_cast<T*>(where);
+	}
+
+	template <class T>
+	void PageAllocator<T>::deallocate(T* where, std::size_t n) noexcept
+	{
+		_ReleasePages(where, _RangeFor(n));
+	}
+
+	template <class T>
+	bool PageAllocator<T>::TryExpand(T* where, std::size_t n, std::size_t new_n) noexcept
+	{
+		if (new_n <= n)
+			return true;
+
+		// A block of new_n items must map to the same range as one of n items, or deallocating it would release the wrong size
+		if (new_n > _RangeFor(n) / sizeof(T) || _RangeFor(new_n) != _RangeFor(n))
+			return false;
+
+		return _CommitPages(reinterpret_cast<unsigned char*>(where) + n * sizeof(T), (new_n - n) * sizeof(T));
+	}
+
+	template <class T>
+	constexpr std::size_t PageAllocator<T>::Reservation() const noexcept
+	{
+		return _Reservation;
+	}
+
+	template <class T>
+	std::size_t PageAllocator<T>::_RangeFor(std::size_t n) const noexcept
+	{
+		const std::size_t page = SystemPageSize();
+		const std::size_t bytes = std::max(std::min(_Reservation, std::numeric_limits<std::size_t>::max() - page), n * sizeof(T));
+
+		return (bytes + page - 1) / page * page;
+	}
+};
\ No newline at end of file
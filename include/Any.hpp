@@ -1,7 +1,10 @@
 #pragma once
 
+#include "Instrumentation.hpp"
 #include "TypeTag.hpp"
 
+#include <memory_resource>
+
 namespace CQue
 {
 	// ####################################### FORWARD DECLARATIONS #######################################
@@ -14,7 +17,13 @@ namespace CQue
 		constexpr Any(Any&& other) noexcept;
 
 		template <class T>
-		constexpr Any(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>);
+		constexpr Any(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(!DecayedSameAs<T, Any> && (std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>));
+
+		/// @brief Creates the value with any heap storage it needs drawn from the given memory resource, e.g. a MonotonicArena.
+		/// The object keeps the resource for its whole lifetime, whatever it stores, and so do copies of it; values of another
+		/// type assigned later are allocated from it too. The resource therefore has to outlive all of them.
+		template <class T>
+		Any(std::allocator_arg_t, std::pmr::memory_resource* resource, T&& val) requires(!DecayedSameAs<T, Any> && (std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>));
 
 		constexpr const TypeTag& CurrentType() const noexcept;
 		constexpr bool IsEmpty() const noexcept;
@@ -26,85 +35,163 @@ namespace CQue
 		template <NonRef T>
 		constexpr T Release();
 
+		/// @brief Pointer to the value if it is a T, otherwise nullptr; for hot paths where a type mismatch is expected and an
+		/// exception would be too costly.
+		template <NonRef T>
+		constexpr const std::remove_const_t<T>* TryGet() const noexcept;
+
+		template <NonRef T>
+		constexpr std::remove_const_t<T>* TryGet() noexcept;
+
+		/// @brief Calls the visitor with the value if it is one of Ts, typically given an overload set, and tells whether it did.
+		/// Only the visitor itself may throw.
+		template <NonRef... Ts, class _Visitor>
+		constexpr bool Visit(_Visitor&& visitor);
+
+		template <NonRef... Ts, class _Visitor>
+		constexpr bool Visit(_Visitor&& visitor) const;
+
 		constexpr Any& operator=(const Any& other);
 		constexpr Any& operator=(Any&& other) noexcept;
 
 		template <class T>
-		constexpr Any& operator=(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>);
+		constexpr Any& operator=(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(!DecayedSameAs<T, Any> && (std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>));
 
 		template <class T>
 		constexpr operator T() const;
 
 		constexpr ~Any();
 
+		friend class AnyList;
+		friend class TypeMap;
+
 	private:
-		struct _ValueStorage
+		class EmptyObjectError : public std::logic_error
 		{
-			virtual constexpr void AssignCopyTo(_ValueStorage*) const = 0;
-			virtual constexpr _ValueStorage* CreateCopy() const = 0;
-			virtual constexpr const TypeTag& GetTypeTag() const noexcept = 0;
-
-			virtual constexpr ~_ValueStorage() = default;
+		public:
+			EmptyObjectError();
+			EmptyObjectError(const EmptyObjectError& other) = default;
 		};
 
-		template <class T>
-		struct _ValueStorageImpl : public _ValueStorage
+		class BadCast : public std::logic_error
 		{
-			constexpr _ValueStorageImpl() noexcept(std::is_nothrow_constructible_v<T>) requires std::is_default_constructible_v<T> = default;
-			constexpr _ValueStorageImpl(const _ValueStorageImpl<T>&) noexcept(std::is_nothrow_copy_constructible_v<T>) requires std::is_copy_constructible_v<T> = default;
-			constexpr _ValueStorageImpl(_ValueStorageImpl<T>&&) noexcept(std::is_nothrow_move_constructible_v<T>) requires std::is_move_constructible_v<T> = default;
+		public:
+			BadCast();
+			BadCast(const BadCast& other) = default;
+		};
 
-			constexpr _ValueStorageImpl(const T& val) noexcept(std::is_nothrow_copy_constructible_v<T>) requires std::is_copy_constructible_v<T>;
-			constexpr _ValueStorageImpl(T&& val) noexcept(std::is_nothrow_move_constructible_v<T>) requires std::is_move_constructible_v<T>;
+		static constexpr std::size_t _InlineSize = 2 * sizeof(void*);
+		static constexpr std::size_t _InlineAlignment = alignof(void*) > alignof(double) ? alignof(void*) : alignof(double);
 
-			virtual constexpr void AssignCopyTo(_ValueStorage* other) const override;
-			virtual constexpr _ValueStorage* CreateCopy() const override;
-			virtual constexpr const TypeTag& GetTypeTag() const noexcept override;
+		// Heap values are referred to through an empty base so that they can be downcast within constant evaluation, which a
+		// cast from void* would not allow.
+		struct _HeapBase {};
 
-			virtual constexpr ~_ValueStorageImpl() = default;
+		template <class T>
+		struct _HeapValue : public _HeapBase
+		{
+			template <class... Args>
+			constexpr _HeapValue(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
 
 			T Value;
 		};
 
-		class EmptyObjectError : public std::logic_error
+		// A null resource stands for plain new/delete
+		struct _HeapRef
 		{
-		public:
-			EmptyObjectError();
-			EmptyObjectError(const EmptyObjectError& other) = default;
+			_HeapBase* Value;
+			std::pmr::memory_resource* Resource;
 		};
 
-		class BadCast : public std::logic_error
+		union _Storage
 		{
-		public:
-			BadCast();
-			BadCast(const BadCast& other) = default;
+			_HeapRef Heap;
+			alignas(_InlineAlignment) unsigned char Buffer[_InlineSize];
+		};
+
+		/// @brief Per-type table of operations. Each stored type refers to exactly one table, hence comparing the table pointers 
+		/// is sufficient to tell whether two objects hold the same type.
+		struct _Operations
+		{
+			const TypeTag* Tag;
+			void (*Copy)(_Storage& dest, const _Storage& src, std::pmr::memory_resource* resource);
+			void (*AssignCopy)(_Storage& dest, const _Storage& src);
+			void (*Move)(_Storage& dest, _Storage& src) noexcept;
+			void (*Destroy)(_Storage& what) noexcept;
 		};
 
-		_ValueStorage* _ptrInstance;
+		template <class T>
+		struct _Manager
+		{
+			static constexpr bool IsInlineStorable = sizeof(T) <= _InlineSize && alignof(T) <= _InlineAlignment && std::is_nothrow_move_constructible_v<T>;
+
+			template <class... Args>
+			static constexpr void Create(_Storage& where, std::pmr::memory_resource* resource, Args&&... args);
+			static constexpr T* Get(const _Storage& what) noexcept;
+
+			static constexpr void Copy(_Storage& dest, const _Storage& src, std::pmr::memory_resource* resource);
+			static constexpr void AssignCopy(_Storage& dest, const _Storage& src);
+			static constexpr void Move(_Storage& dest, _Storage& src) noexcept;
+			static constexpr void Destroy(_Storage& what) noexcept;
+
+			// Values created during constant evaluation always live on the heap since placement into raw storage is not permitted there
+			static constexpr bool StoredInline() noexcept;
+
+			static constexpr _Operations Table = { &TypeTag::_TagGenerator<T>::Tag, &Copy, &AssignCopy, &Move, &Destroy };
+		};
+
+		template <class T>
+		static constexpr const _Operations* _OperationsOf = &_Manager<std::decay_t<T>>::Table;
+
+		const _Operations* _ptrOps;
+
+		// Resource new values are allocated from. A heap value remembers the resource it came from on its own, since moving
+		// from another object may hand over a value allocated elsewhere.
+		std::pmr::memory_resource* _Resource;
+		_Storage _Data;
 	};
 
 	// ######################################## BODY DECLARATIONS #########################################
 
 	// *********************************************** Any ************************************************
 
-	constexpr Any::Any() noexcept : _ptrInstance(nullptr) {}
-	constexpr Any::Any(const Any& other) : _ptrInstance(other._ptrInstance->CreateCopy()) {}
-	constexpr Any::Any(Any&& other) noexcept : _ptrInstance(std::exchange(other._ptrInstance, nullptr)) {}
+	constexpr Any::Any() noexcept : _ptrOps(nullptr), _Resource(nullptr) {}
+
+	constexpr Any::Any(const Any& other) : _ptrOps(other._ptrOps), _Resource(other._Resource)
+	{
+		if (_ptrOps)
+			_ptrOps->Copy(_Data, other._Data, _Resource);
+	}
+
+	constexpr Any::Any(Any&& other) noexcept : _ptrOps(std::exchange(other._ptrOps, nullptr)), _Resource(other._Resource)
+	{
+		if (_ptrOps)
+			_ptrOps->Move(_Data, other._Data);
+	}
+
+	template <class T>
+	constexpr Any::Any(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(!DecayedSameAs<T, Any> && (std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>)) : _ptrOps(_OperationsOf<T>), _Resource(nullptr)
+	{
+		_Manager<std::decay_t<T>>::Create(_Data, nullptr, std::forward<T>(val));
+	}
 
 	template <class T>
-	constexpr Any::Any(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>) : _ptrInstance(new _ValueStorageImpl<std::decay_t<T>>(std::forward<T>(val))) {}
+	Any::Any(std::allocator_arg_t, std::pmr::memory_resource* resource, T&& val) requires(!DecayedSameAs<T, Any> && (std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>)) : _ptrOps(_OperationsOf<T>), _Resource(resource)
+	{
+		_Manager<std::decay_t<T>>::Create(_Data, resource, std::forward<T>(val));
+	}
 
 	constexpr const TypeTag& Any::CurrentType() const noexcept
 	{
-		if (_ptrInstance)
-			return _ptrInstance->GetTypeTag();
+		if (_ptrOps)
+			return *_ptrOps->Tag;
 		else
 			return TypeTag::_TagGenerator<void>::Tag;
 	}
 
 	constexpr bool Any::IsEmpty() const noexcept
 	{
-		return (_ptrInstance == nullptr);
+		return (_ptrOps == nullptr);
 	}
 
 	template <NonRef T>
@@ -116,66 +203,104 @@ namespace CQue
 	template <NonRef T>
 	constexpr T Any::Release()
 	{
-		if(_ptrInstance)
+		if (_ptrOps == _OperationsOf<T>)
 		{
-			if (_ptrInstance->GetTypeTag() == TypeTag::_TagGenerator<std::decay_t<T>>::Tag)
-			{
-				T res = std::move(static_cast<_ValueStorageImpl<T>*>(_ptrInstance)->Value);
-				delete _ptrInstance;
-				_ptrInstance = nullptr;
-				return res;
-			}
-			else
-				throw BadCast();
+			T res = std::move(*_Manager<std::decay_t<T>>::Get(_Data));
+			Reset();
+			return res;
+		}
+		else if (_ptrOps)
+		{
+			CQUE_RECORD(AnyBadCasts, 1);
+			throw BadCast();
 		}
 		else
 			throw EmptyObjectError();
 	}
 
+	template <NonRef T>
+	constexpr const std::remove_const_t<T>* Any::TryGet() const noexcept
+	{
+		return (_ptrOps == _OperationsOf<T>) ? _Manager<std::decay_t<T>>::Get(_Data) : nullptr;
+	}
+
+	template <NonRef T>
+	constexpr std::remove_const_t<T>* Any::TryGet() noexcept
+	{
+		return (_ptrOps == _OperationsOf<T>) ? _Manager<std::decay_t<T>>::Get(_Data) : nullptr;
+	}
+
+	template <NonRef... Ts, class _Visitor>
+	constexpr bool Any::Visit(_Visitor&& visitor)
+	{
+		return (... || (_ptrOps == _OperationsOf<Ts> && (std::invoke(visitor, *_Manager<std::decay_t<Ts>>::Get(_Data)), true)));
+	}
+
+	template <NonRef... Ts, class _Visitor>
+	constexpr bool Any::Visit(_Visitor&& visitor) const
+	{
+		return (... || (_ptrOps == _OperationsOf<Ts> && (std::invoke(visitor, std::as_const(*_Manager<std::decay_t<Ts>>::Get(_Data))), true)));
+	}
+
 	constexpr void Any::Reset()
 	{
-		if(_ptrInstance)
-			delete _ptrInstance, _ptrInstance = nullptr;
+		if (_ptrOps)
+			std::exchange(_ptrOps, nullptr)->Destroy(_Data);
 	}
 
 	constexpr Any& Any::operator=(const Any& other)
 	{
-		// The null check is done because there is a need of dereferencing
-		if (_ptrInstance)
+		if (_ptrOps == other._ptrOps)
 		{
-			if (_ptrInstance->GetTypeTag() == other._ptrInstance->GetTypeTag())
-				other._ptrInstance->AssignCopyTo(_ptrInstance);
-			else
-				delete _ptrInstance, _ptrInstance = other._ptrInstance->CreateCopy();
+			if (_ptrOps)
+				_ptrOps->AssignCopy(_Data, other._Data);
 		}
+		else if (!other._ptrOps)
+			Reset();
 		else
-			_ptrInstance = other._ptrInstance->CreateCopy();
+		{
+			// The other object may be part of the current value, so copy it aside before the current value goes away
+			Any value;
+			other._ptrOps->Copy(value._Data, other._Data, _Resource);
+			value._ptrOps = other._ptrOps;
+
+			*this = std::move(value);
+		}
 
 		return *this;
 	}
 
 	constexpr Any& Any::operator=(Any&& other) noexcept
 	{
-		delete _ptrInstance;
-		_ptrInstance = std::exchange(other._ptrInstance, nullptr);
+		if (this != &other)
+		{
+			Reset();
+
+			if (other._ptrOps)
+			{
+				other._ptrOps->Move(_Data, other._Data);
+				_ptrOps = std::exchange(other._ptrOps, nullptr);
+			}
+		}
 
 		return *this;
 	}
 
 	template <class T>
-	constexpr Any& Any::operator=(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>)
+	constexpr Any& Any::operator=(T&& val) noexcept(noexcept(std::decay_t<T>(std::forward<T>(val)))) requires(!DecayedSameAs<T, Any> && (std::is_reference_v<T> ? std::is_copy_constructible_v<T> : std::is_move_constructible_v<T>))
 	{
-		// The null check is done because there is a need of dereferencing
-		if (_ptrInstance)
+		// If the type is still the same, reuse the instance. Otherwise, create a new one from the object's memory resource, and
+		// only then destroy the previous instance, as the value may refer into it.
+		if (_ptrOps == _OperationsOf<T>)
+			*_Manager<std::decay_t<T>>::Get(_Data) = std::forward<T>(val);
+		else
 		{
-			// If the type is still the same, reuse the instance. Otherwise, destroy the previous instance and create a new one.
-			if (_ptrInstance->GetTypeTag() == TypeTag::_TagGenerator<std::decay_t<T>>::Tag)
-				static_cast<_ValueStorageImpl<std::decay_t<T>>*>(_ptrInstance)->Value = std::forward<T>(val);
-			else
-				delete _ptrInstance, _ptrInstance = new _ValueStorageImpl<std::decay_t<T>>(std::forward<T>(val));
+			Any value;
+			_Manager<std::decay_t<T>>::Create(value._Data, _Resource, std::forward<T>(val));
+			value._ptrOps = _OperationsOf<T>;
+
+			*this = std::move(value);
 		}
-		else
-			_ptrInstance = new _ValueStorageImpl<std::decay_t<T>>(std::forward<T>(val));
 
 		return *this;
 	}
@@ -183,12 +308,12 @@ namespace CQue
 	template <class T>
 	constexpr Any::operator T() const
 	{
-		if (_ptrInstance)
+		if (_ptrOps == _OperationsOf<T>)
+			return *_Manager<std::decay_t<T>>::Get(_Data);
+		else if (_ptrOps)
 		{
-			if (_ptrInstance->GetTypeTag() == TypeTag::_TagGenerator<std::decay_t<T>>::Tag)
-				return static_cast<_ValueStorageImpl<std::decay_t<T>>*>(_ptrInstance)->Value;
-			else
-				throw BadCast();
+			CQUE_RECORD(AnyBadCasts, 1);
+			throw BadCast();
 		}
 		else
 			throw EmptyObjectError();
@@ -196,35 +321,100 @@ namespace CQue
 
 	constexpr Any::~Any()
 	{
-		delete _ptrInstance;
+		Reset();
 	}
 
-	// *********************************** Any::_ValueDescriptorImpl<T> ***********************************
+	// **************************************** Any::_HeapValue<T> ****************************************
 
 	template <class T>
-	constexpr Any::_ValueStorageImpl<T>::_ValueStorageImpl(const T& val) noexcept(std::is_nothrow_copy_constructible_v<T>) requires std::is_copy_constructible_v<T> : Value(val) {}
+	template <class... Args>
+	constexpr Any::_HeapValue<T>::_HeapValue(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) : Value(std::forward<Args>(args)...) {}
+
+	// ***************************************** Any::_Manager<T> *****************************************
 
 	template <class T>
-	constexpr Any::_ValueStorageImpl<T>::_ValueStorageImpl(T&& val) noexcept(std::is_nothrow_move_constructible_v<T>) requires std::is_move_constructible_v<T> : Value(std::move(val)) {}
+	template <class... Args>
+	constexpr void Any::_Manager<T>::Create(_Storage& where, std::pmr::memory_resource* resource, Args&&... args)
+	{
+		if (StoredInline())
+		{
+			CQUE_RECORD(AnyInlineStores, 1);
+			::new (static_cast<void*>(where.Buffer)) T(std::forward<Args>(args)...);
+			return;
+		}
+
+		CQUE_RECORD(AnyHeapStores, 1);
+
+		if (!resource)
+			where.Heap = { new _HeapValue<T>(std::forward<Args>(args)...), nullptr };
+		else
+		{
+			void* memory = resource->allocate(sizeof(_HeapValue<T>), alignof(_HeapValue<T>));
+			try
+			{
+				where.Heap = { ::new (memory) _HeapValue<T>(std::forward<Args>(args)...), resource };
+			}
+			catch (...)
+			{
+				resource->deallocate(memory, sizeof(_HeapValue<T>), alignof(_HeapValue<T>));
+				throw;
+			}
+		}
+	}
 
 	template <class T>
-	constexpr void Any::_ValueStorageImpl<T>::AssignCopyTo(_ValueStorage* other) const
+	constexpr T* Any::_Manager<T>::Get(const _Storage& what) noexcept
 	{
-		if (other->GetTypeTag() == this->GetTypeTag())
-			static_cast<_ValueStorageImpl<T>*>(other)->Value = Value;
+		if (StoredInline())
+			return std::launder(reinterpret_cast<T*>(const_cast<unsigned char*>(what.Buffer)));
 		else
-			throw std::logic_error("Bruh");
+			return &static_cast<_HeapValue<T>*>(what.Heap.Value)->Value;
+	}
+
+	template <class T>
+	constexpr void Any::_Manager<T>::Copy(_Storage& dest, const _Storage& src, std::pmr::memory_resource* resource)
+	{
+		Create(dest, resource, *Get(src));
 	}
 
 	template <class T>
-	constexpr Any::_ValueStorage* Any::_ValueStorageImpl<T>::CreateCopy() const
+	constexpr void Any::_Manager<T>::AssignCopy(_Storage& dest, const _Storage& src)
 	{
-		return new _ValueStorageImpl<T>(Value);
+		*Get(dest) = *Get(src);
+	}
+
+	template <class T>
+	constexpr void Any::_Manager<T>::Move(_Storage& dest, _Storage& src) noexcept
+	{
+		// Inline values have to be moved into the destination's own buffer, heap values can simply change hands
+		if (StoredInline())
+		{
+			T* from = Get(src);
+			::new (static_cast<void*>(dest.Buffer)) T(std::move(*from));
+			std::destroy_at(from);
+		}
+		else
+			dest.Heap = std::exchange(src.Heap, _HeapRef{ nullptr, nullptr });
+	}
+
+	template <class T>
+	constexpr void Any::_Manager<T>::Destroy(_Storage& what) noexcept
+	{
+		if (StoredInline())
+			std::destroy_at(Get(what));
+		else if (!what.Heap.Resource)
+			delete static_cast<_HeapValue<T>*>(what.Heap.Value);
+		else
+		{
+			_HeapValue<T>* value = static_cast<_HeapValue<T>*>(what.Heap.Value);
+			std::destroy_at(value);
+			what.Heap.Resource->deallocate(value, sizeof(_HeapValue<T>), alignof(_HeapValue<T>));
+		}
 	}
 
 	template <class T>
-	constexpr const TypeTag& Any::_ValueStorageImpl<T>::GetTypeTag() const noexcept
+	constexpr bool Any::_Manager<T>::StoredInline() noexcept
 	{
-		return TypeTag::_TagGenerator<std::decay_t<T>>::Tag;
+		return IsInlineStorable && !std::is_constant_evaluated();
 	}
 };
\ No newline at end of file
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Any.hpp"
+#include "Containers.hpp"
+#include "TypeMap.hpp"
+
+namespace CQue
+{
+	// ####################################### FORWARD DECLARATIONS #######################################
+
+	/// @brief Heterogeneous collection which keeps the items of each type together in a List<T> of their own, a segment,
+	/// rather than one Any per item. Visiting the items of a type walks a dense array of them with no per-item allocation,
+	/// pointer chase, or type check. Segments are found by the types' registry indices, as in TypeMap. The order in which
+	/// items of the same type were added is kept; the order across types is not. Items have to be copyable, as Any's values
+	/// do. Not synchronized.
+	class AnyList
+	{
+	public:
+		AnyList() noexcept;
+
+		// Non-Template Member Functions
+
+		/// @brief Removes every item, keeping the segments' memory for reuse.
+		void Clear() noexcept;
+
+		/// @brief Number of items of all types.
+		std::size_t Count() const noexcept;
+
+		// Template Member Functions
+
+		template <class T>
+		std::decay_t<T>& Add(T&& what);
+
+		template <NonRef T>
+		std::size_t Count() const;
+
+		template <NonRef T, class... Args>
+		T& Emplace(Args&&... args);
+
+		/// @brief Calls the function on every item of type T, in the order they were added.
+		template <NonRef T, std::invocable<T&> _Function>
+		void ForEach(_Function func);
+
+		template <NonRef T, std::invocable<const T&> _Function>
+		void ForEach(_Function func) const;
+
+		/// @brief Items of type T, in the order they were added.
+		template <NonRef T>
+		IterWrapper<T> OfType();
+
+		template <NonRef T>
+		IterWrapper<const T> OfType() const;
+
+		/// @brief Calls the visitor, e.g. an overload set, on every item of each of the given types, one type after another.
+		template <NonRef... Ts, class _Visitor>
+		void Visit(_Visitor&& visitor);
+
+		template <NonRef... Ts, class _Visitor>
+		void Visit(_Visitor&& visitor) const;
+
+	private:
+		// A slot with empty Items has no segment; otherwise Items holds a List<T>
+		struct _Segment
+		{
+			Any Items;
+			void (*Clear)(Any& items) noexcept = nullptr;
+		};
+
+		template <class T>
+		static void _ClearSegment(Any& items) noexcept;
+
+		template <class T>
+		List<T>* _ItemsOf() const;
+
+		template <class T>
+		List<T>& _SegmentFor();
+
+		_TypeSlots<_Segment> _Segments;
+		std::size_t _Count;
+	};
+
+	// ######################################## BODY DECLARATIONS #########################################
+
+	// ********************************************* AnyList **********************************************
+
+	template <class T>
+	std::decay_t<T>& AnyList::Add(T&& what)
+	{
+		return Emplace<std::decay_t<T>>(std::forward<T>(what));
+	}
+
+	template <NonRef T>
+	std::size_t AnyList::Count() const
+	{
+		const List<T>* items = _ItemsOf<T>();
+		return items ? items->Count() : 0;
+	}
+
+	template <NonRef T, class... Args>
+	T& AnyList::Emplace(Args&&... args)
+	{
+		static_assert(!std::is_const_v<T>, "AnyList holds non-const items");
+
+		List<T>& items = _SegmentFor<T>();
+		T& added = items.Emplace(std::forward<Args>(args)...);
+		_Count++;
+
+		return added;
+	}
+
+	template <NonRef T, std::invocable<T&> _Function>
+	void AnyList::ForEach(_Function func)
+	{
+		if (List<T>* items = _ItemsOf<T>())
+			for (T& item : *items)
+				std::invoke(func, item);
+	}
+
+	template <NonRef T, std::invocable<const T&> _Function>
+	void AnyList::ForEach(_Function func) const
+	{
+		if (const List<T>* items = _ItemsOf<T>())
+			for (const T& item : *items)
+				std::invoke(func, item);
+	}
+
+	template <NonRef T>
+	IterWrapper<T> AnyList::OfType()
+	{
+		if (List<T>* items = _ItemsOf<T>())
+			return IterWrapper<T>(items->begin(), items->end());
+		else
+			return IterWrapper<T>(nullptr, nullptr);
+	}
+
+	template <NonRef T>
+	IterWrapper<const T> AnyList::OfType() const
+	{
+		if (const List<T>* items = _ItemsOf<T>())
+			return IterWrapper<const T>(items->cbegin(), items->cend());
+		else
+			return IterWrapper<const T>(nullptr, nullptr);
+	}
+
+	template <NonRef... Ts, class _Visitor>
+	void AnyList::Visit(_Visitor&& visitor)
+	{
+		(ForEach<Ts>([&](Ts& item) { std::invoke(visitor, item); }), ...);
+	}
+
+	template <NonRef... Ts, class _Visitor>
+	void AnyList::Visit(_Visitor&& visitor) const
+	{
+		(ForEach<Ts>([&](const Ts& item) { std::invoke(visitor, item); }), ...);
+	}
+
+	template <class T>
+	void AnyList::_ClearSegment(Any& items) noexcept
+	{
+		Any::_Manager<List<T>>::Get(items._Data)->Clear();
+	}
+
+	template <class T>
+	List<T>* AnyList::_ItemsOf() const
+	{
+		// The segment of a type only ever holds a List of that type, which spares comparing the types
+		const _Segment& slot = _Segments.Find(GetType<T>().GetIndex());
+
+		return slot.Items._ptrOps ? Any::_Manager<List<T>>::Get(slot.Items._Data) : nullptr;
+	}
+
+	template <class T>
+	List<T>& AnyList::_SegmentFor()
+	{
+		// Lists are larger than what Any holds inline, so each segment stays put while the slots move
+		_Segment& slot = _Segments.At(GetType<T>().GetIndex());
+		if (slot.Items.IsEmpty())
+		{
+			slot.Items = List<T>();
+			slot.Clear = &_ClearSegment<T>;
+		}
+
+		return *Any::_Manager<List<T>>::Get(slot.Items._Data);
+	}
+};
\ No newline at end of file
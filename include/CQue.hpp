@@ -1,4 +1,22 @@
 #pragma once
 
+#include "Allocators.hpp"
 #include "Any.hpp"
-#include "Containers.hpp"
\ No newline at end of file
+#include "AnyList.hpp"
+#include "ConcurrentQueue.hpp"
+#include "Containers.hpp"
+#include "Dictionary.hpp"
+#include "EytzingerIndex.hpp"
+#include "HashSet.hpp"
+#include "InlineList.hpp"
+#include "Instrumentation.hpp"
+#include "MappedList.hpp"
+#include "Parallel.hpp"
+#include "Query.hpp"
+#include "RingBuffer.hpp"
+#include "SharedList.hpp"
+#include "Simd.hpp"
+#include "SoAList.hpp"
+#include "StaticList.hpp"
+#include "ThreadPool.hpp"
+#include "TypeMap.hpp"
\ No newline at end of file
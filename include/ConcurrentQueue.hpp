@@ -0,0 +1,267 @@
+#pragma once
+
+#include "Containers.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief Bounded lock-free queue for any number of producer and consumer threads, after Dmitry Vyukov's bounded MPMC
+    /// queue. Every cell carries a sequence number telling whether it awaits an item or its removal for the current lap, so
+    /// that an operation claims a cell with a single compare-and-swap on the shared position and then hands the cell over with
+    /// a single store. The producers' and the consumers' positions sit on cache lines of their own. A full or empty queue is
+    /// reported rather than waited on. Items need to be nothrow movable, as an item is moved into and out of a cell once it is
+    /// claimed; copies are made beforehand. Neither copyable nor movable.
+    /// @tparam T Type of the items
+    template <class T, class Allocator = std::allocator<T>>
+    class ConcurrentQueue
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "ConcurrentQueue needs nothrow movable items");
+
+    public:
+        // Constructors
+
+        /// @brief Creates an empty queue holding up to `capacity` items, rounded up to a power of 2 of at least 2.
+        explicit ConcurrentQueue(std::size_t capacity, const Allocator& alloc = Allocator());
+        ConcurrentQueue(const ConcurrentQueue&) = delete;
+
+        // Member Functions
+
+        std::size_t Capacity() const noexcept;
+
+        /// @brief Removes every item, including any added meanwhile.
+        void Clear() noexcept;
+
+        /// @brief Number of items, exact unless other threads are busy with the queue meanwhile.
+        std::size_t Count() const noexcept;
+
+        /// @brief Moves up to `count` items into `out`, in the order they were removed, and returns how many.
+        std::size_t DequeueRange(T* out, std::size_t count);
+
+        /// @brief Copies as many of the items as fit, in order, and returns how many.
+        std::size_t EnqueueRange(const T* items, std::size_t count);
+
+        Allocator GetAllocator() const noexcept;
+        bool IsEmpty() const noexcept;
+
+        /// @brief Moves the oldest item into `out` and returns true, or returns false if the queue is empty.
+        bool TryDequeue(T& out) noexcept;
+
+        /// @brief Adds the item unless the queue is full, and tells whether it did.
+        bool TryEnqueue(const T& what);
+        bool TryEnqueue(T&& what) noexcept;
+
+        template <class... Args>
+        bool TryEmplace(Args&&... args);
+
+        // Operators
+
+        ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+        // Destructor
+
+        ~ConcurrentQueue();
+
+    private:
+        struct _Cell
+        {
+            std::atomic<std::size_t> Sequence;
+            alignas(T) unsigned char Storage[sizeof(T)];
+
+            T* Item() noexcept { return std::launder(reinterpret_cast<T*>(Storage)); }
+        };
+
+        using _CellAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<_Cell>;
+        using _CellTraits = std::allocator_traits<_CellAllocator>;
+
+        // Set up once and only read afterwards, hence shared by every thread without contention
+        CQUE_NO_UNIQUE_ADDRESS _CellAllocator _Alloc;
+        _Cell* _Cells;
+        std::size_t _Mask;
+
+        alignas(CacheLineSize) std::atomic<std::size_t> _EnqueuePosition;
+        alignas(CacheLineSize) std::atomic<std::size_t> _DequeuePosition;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ********************************** ConcurrentQueue<T, Allocator> ***********************************
+
+#if 1
+    // ConcurrentQueue<T, Allocator> - Constructors
+
+    template <class T, class Allocator>
+    ConcurrentQueue<T, Allocator>::ConcurrentQueue(std::size_t capacity, const Allocator& alloc) : _Alloc(alloc), _Cells(nullptr),
+        _Mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1), _EnqueuePosition(0), _DequeuePosition(0)
+    {
+        _Cells = _CellTraits::allocate(_Alloc, _Mask + 1);
+
+        // Cell i first awaits the item of position i
+        for (std::size_t i = 0; i <= _Mask; i++)
+            ::new (static_cast<void*>(&_Cells[i])) _Cell{ i, {} };
+    }
+
+    // ConcurrentQueue<T, Allocator> - Member Functions
+
+    template <class T, class Allocator>
+    std::size_t ConcurrentQueue<T, Allocator>::Capacity() const noexcept
+    {
+        return _Mask + 1;
+    }
+
+    template <class T, class Allocator>
+    void ConcurrentQueue<T, Allocator>::Clear() noexcept
+    {
+        for (;;)
+        {
+            std::size_t position = _DequeuePosition.load(std::memory_order_relaxed);
+            _Cell* cell;
+
+            for (;;)
+            {
+                cell = &_Cells[position & _Mask];
+                std::intptr_t lag = static_cast<std::intptr_t>(cell->Sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(position + 1);
+
+                if (lag == 0 && _DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+                else if (lag < 0)
+                    return;
+                else if (lag > 0)
+                    position = _DequeuePosition.load(std::memory_order_relaxed);
+            }
+
+            std::destroy_at(cell->Item());
+            cell->Sequence.store(position + _Mask + 1, std::memory_order_release);
+        }
+    }
+
+    template <class T, class Allocator>
+    std::size_t ConcurrentQueue<T, Allocator>::Count() const noexcept
+    {
+        std::size_t dequeued = _DequeuePosition.load(std::memory_order_acquire);
+        std::size_t enqueued = _EnqueuePosition.load(std::memory_order_acquire);
+
+        std::intptr_t count = static_cast<std::intptr_t>(enqueued - dequeued);
+        return (count > 0) ? std::min(static_cast<std::size_t>(count), _Mask + 1) : 0;
+    }
+
+    template <class T, class Allocator>
+    std::size_t ConcurrentQueue<T, Allocator>::DequeueRange(T* out, std::size_t count)
+    {
+        // Every item needs a cell of its own claimed, as the cells past the first may still be being filled
+        std::size_t i = 0;
+        while (i < count && TryDequeue(out[i]))
+            i++;
+
+        return i;
+    }
+
+    template <class T, class Allocator>
+    std::size_t ConcurrentQueue<T, Allocator>::EnqueueRange(const T* items, std::size_t count)
+    {
+        std::size_t i = 0;
+        while (i < count && TryEnqueue(items[i]))
+            i++;
+
+        return i;
+    }
+
+    template <class T, class Allocator>
+    Allocator ConcurrentQueue<T, Allocator>::GetAllocator() const noexcept
+    {
+        return Allocator(_Alloc);
+    }
+
+    template <class T, class Allocator>
+    bool ConcurrentQueue<T, Allocator>::IsEmpty() const noexcept
+    {
+        return (Count() == 0);
+    }
+
+    template <class T, class Allocator>
+    bool ConcurrentQueue<T, Allocator>::TryDequeue(T& out) noexcept
+    {
+        std::size_t position = _DequeuePosition.load(std::memory_order_relaxed);
+        _Cell* cell;
+
+        for (;;)
+        {
+            cell = &_Cells[position & _Mask];
+            std::intptr_t lag = static_cast<std::intptr_t>(cell->Sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(position + 1);
+
+            // A cell holding the item of the position awaits removal; one still awaiting it means the queue is empty
+            if (lag == 0 && _DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+            else if (lag < 0)
+                return false;
+            else if (lag > 0)
+                position = _DequeuePosition.load(std::memory_order_relaxed);
+        }
+
+        T* item = cell->Item();
+        out = std::move(*item);
+        std::destroy_at(item);
+
+        // The cell now awaits the item of the same slot on the next lap
+        cell->Sequence.store(position + _Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <class T, class Allocator>
+    bool ConcurrentQueue<T, Allocator>::TryEnqueue(const T& what)
+    {
+        T copy(what);
+        return TryEnqueue(std::move(copy));
+    }
+
+    template <class T, class Allocator>
+    bool ConcurrentQueue<T, Allocator>::TryEnqueue(T&& what) noexcept
+    {
+        std::size_t position = _EnqueuePosition.load(std::memory_order_relaxed);
+        _Cell* cell;
+
+        for (;;)
+        {
+            cell = &_Cells[position & _Mask];
+            std::intptr_t lag = static_cast<std::intptr_t>(cell->Sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(position);
+
+            // A cell still holding the item of the previous lap means the queue is full
+            if (lag == 0 && _EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+            else if (lag < 0)
+                return false;
+            else if (lag > 0)
+                position = _EnqueuePosition.load(std::memory_order_relaxed);
+        }
+
+        std::construct_at(cell->Item(), std::move(what));
+        cell->Sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    template <class T, class Allocator>
+    template <class... Args>
+    bool ConcurrentQueue<T, Allocator>::TryEmplace(Args&&... args)
+    {
+        T item(std::forward<Args>(args)...);
+        return TryEnqueue(std::move(item));
+    }
+
+    // ConcurrentQueue<T, Allocator> - Destructor
+
+    template <class T, class Allocator>
+    ConcurrentQueue<T, Allocator>::~ConcurrentQueue()
+    {
+        Clear();
+
+        for (std::size_t i = 0; i <= _Mask; i++)
+            std::destroy_at(&_Cells[i]);
+
+        _CellTraits::deallocate(_Alloc, _Cells, _Mask + 1);
+    }
+#endif
+};
\ No newline at end of file
@@ -1,27 +1,65 @@
 #pragma once
 
+#include "Allocators.hpp"
 #include "base_include.hpp"
+#include "Instrumentation.hpp"
+#include "Simd.hpp"
 
 // ####################################### FORWARD DECLARATIONS #######################################
 
 namespace CQue::Container
 {
+    // The overloads taking any callable let the compiler inline the call, whereas the ones taking a function pointer, kept for 
+    // compatibility, make an indirect call per item.
+
+    /// @brief Searches a container sorted by `compare` for an item equivalent to `what`, the way .NET does: returns the index of
+    /// such an item or, if there is none, the bitwise complement of the index at which `what` would be inserted, which is always
+    /// greater than or equal to the number of items.
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::strict_weak_order<const T&, const T&> _Compare = DefaultComparer<T>>
+    constexpr std::size_t BinarySearch(const _Container& container, const T& what, _Compare compare = _Compare());
+
+    template <class T, ForwardIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr bool Exists(const _Container& container, _Predicate match);
+
     template <class T, ForwardIterableObjectOf<T> _Container>
     constexpr bool Exists(const _Container& container, Predicate<const T&> match);
 
+    template <class T, ForwardIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr T Find(const _Container& container, _Predicate match);
+
     template <class T, ForwardIterableObjectOf<T> _Container>
     constexpr T Find(const _Container& container, Predicate<const T&> match);
 
+    template <class T, ForwardIterableObjectOf<T> _Container, ForwardIterableObjectOf<T> _OutputContainer = _Container, std::predicate<const T&> _Predicate>
+    constexpr _OutputContainer FindAll(const _Container& container, _Predicate match);
+
     template <class T, ForwardIterableObjectOf<T> _Container, ForwardIterableObjectOf<T> _OutputContainer = _Container>
     constexpr _OutputContainer FindAll(const _Container& container, Predicate<const T&> match);
 
+    /// @brief Writes every item matching the predicate to the output iterator, in order, and returns the iterator past the last 
+    /// item written; nothing is allocated.
+    template <class T, ForwardIterableObjectOf<T> _Container, std::output_iterator<const T&> _OutputIterator, std::predicate<const T&> _Predicate>
+    constexpr _OutputIterator FindAll(const _Container& container, _Predicate match, _OutputIterator out);
+
+    template <class T, ForwardIterableObjectOf<T> _Container, std::output_iterator<const T&> _OutputIterator>
+    constexpr _OutputIterator FindAll(const _Container& container, Predicate<const T&> match, _OutputIterator out);
+
+    template <class T, ForwardIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr std::size_t FindIndex(const _Container& container, _Predicate match);
+
     template <class T, ForwardIterableObjectOf<T> _Container>
     constexpr std::size_t FindIndex(const _Container& container, Predicate<const T&> match);
 
-    template <class T, ForwardIterableObjectOf<T> _Container>
+    template <class T, BidirectionalIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr T FindLast(const _Container& container, _Predicate match);
+
+    template <class T, BidirectionalIterableObjectOf<T> _Container>
     constexpr T FindLast(const _Container& container, Predicate<const T&> match);
 
-    template <class T, ForwardIterableObjectOf<T> _Container>
+    template <class T, BidirectionalIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr std::size_t FindLastIndex(const _Container& container, _Predicate match);
+
+    template <class T, BidirectionalIterableObjectOf<T> _Container>
     constexpr std::size_t FindLastIndex(const _Container& container, Predicate<const T&> match);
 
     template <std::equality_comparable T, ForwardIterableObjectOf<T> _Container>
@@ -30,11 +68,35 @@ namespace CQue::Container
     template <std::equality_comparable T, BidirectionalIterableObjectOf<T> _Container>
     constexpr std::size_t LastIndexOf(const _Container& container, const T& what) noexcept(noexcept(std::declval<T>() == std::declval<T>()));
 
+    /// @brief Index of the first item of a container sorted by `compare` which is not ordered before `what`, or the number of
+    /// items if there is none.
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::strict_weak_order<const T&, const T&> _Compare = DefaultComparer<T>>
+    constexpr std::size_t LowerBound(const _Container& container, const T& what, _Compare compare = _Compare());
+
+    /// @brief Writes the items of two containers sorted by `compare` to the output iterator as a single sorted sequence, in 
+    /// linear time, and returns the iterator past the last item written. Of equivalent items, those of `first` come first.
+    template <class T, ForwardIterableObjectOf<T> _First, ForwardIterableObjectOf<T> _Second, std::output_iterator<const T&> _OutputIterator, std::strict_weak_order<const T&, const T&> _Compare = DefaultComparer<T>>
+    constexpr _OutputIterator MergeSorted(const _First& first, const _Second& second, _OutputIterator out, _Compare compare = _Compare());
+
     template <RandomAccessIterable _Container>
     constexpr void Reverse(_Container& container);
 
     template <RandomAccessIterable _Container, class T = std::decay_t<decltype(*std::declval<_Container>().begin())>>
-    constexpr void Sort(_Container& container, Comparison<T> compare = &DefaultCompare<T>);
+    constexpr void Sort(_Container& container);
+
+    template <RandomAccessIterable _Container, class T = std::decay_t<decltype(*std::declval<_Container>().begin())>, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void Sort(_Container& container, _Compare compare);
+
+    template <RandomAccessIterable _Container, class T = std::decay_t<decltype(*std::declval<_Container>().begin())>, ThreeWayComparison<T> _Compare>
+    constexpr void Sort(_Container& container, _Compare compare);
+
+    template <RandomAccessIterable _Container, class T = std::decay_t<decltype(*std::declval<_Container>().begin())>>
+    constexpr void Sort(_Container& container, Comparison<T> compare);
+
+    /// @brief Index of the first item of a container sorted by `compare` which is ordered after `what`, or the number of items if
+    /// there is none.
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::strict_weak_order<const T&, const T&> _Compare = DefaultComparer<T>>
+    constexpr std::size_t UpperBound(const _Container& container, const T& what, _Compare compare = _Compare());
 };
 
 namespace CQue
@@ -48,8 +110,24 @@ namespace CQue
     template <std::forward_iterator _InputIterator, std::forward_iterator _OutputIterator>
     constexpr _OutputIterator UninitializedMove(_InputIterator _First, _InputIterator _Last, _OutputIterator _Dest) noexcept(std::is_nothrow_move_constructible_v<std::remove_reference_t<decltype(*_Dest)>*>);
 
+    template <class T>
+    constexpr T* UninitializedRelocate(T* _First, T* _Last, T* _Dest) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    template <class T>
+    class _StrideIterator;
+
+    template <class T>
+    class _ChunkIterator;
+
+    template <class T>
+    class StrideWrapper;
+
+    template <class T>
+    class ChunkWrapper;
+
     /// @brief A naive, shallow wrapper class for referring to an iterable class whose iterators are convertible to or are themselves 
-    /// pointers.
+    /// pointers. Slice, Stride, and Chunk view parts of the same items without copying them; as the wrapper, they satisfy
+    /// RandomAccessIterable, so CQue::Container sorts and searches the viewed items in place. Mutable unless T is const.
     /// @tparam T Type of object(s) to be iterated upon
     template <class T>
     class IterWrapper
@@ -62,130 +140,375 @@ namespace CQue
         template <ForwardIterableObjectOf<T> _It>
         constexpr IterWrapper(const _It& iter) noexcept;
 
+        // Member Functions
+
+        /// @brief Views the items in consecutive groups of `size`, the last of which may hold fewer; a size above Count() is
+        /// taken as Count(). Throws std::invalid_argument if `size` is 0.
+        constexpr ChunkWrapper<T> Chunk(std::size_t size) const;
+
+        constexpr std::size_t Count() const noexcept;
+
+        /// @brief Views `count` items from `offset` on. Throws std::out_of_range if they are not all within this view.
+        constexpr IterWrapper<T> Slice(std::size_t offset, std::size_t count) const;
+
+        /// @brief Views every `step`th item, starting with the first; a step above Count() is taken as Count(). Throws
+        /// std::invalid_argument if `step` is 0.
+        constexpr StrideWrapper<T> Stride(std::size_t step) const;
+
+        // Operators
+
+        constexpr T& operator[](std::size_t index);
+        constexpr const T& operator[](std::size_t index) const;
+
         // Iterators
 
+        constexpr T* begin() noexcept;
         constexpr const T* begin() const noexcept;
+        constexpr T* end() noexcept;
         constexpr const T* end() const noexcept;
     private:
         T* _First, * _Last;
     };
+
+    template <ForwardIterable _It>
+    IterWrapper(_It&) -> IterWrapper<std::remove_reference_t<decltype(*std::declval<_It&>().begin())>>;
+
+    /// @brief View of every so many items of an IterWrapper<T>, made by IterWrapper<T>::Stride.
+    /// @tparam T Type of object(s) to be iterated upon
+    template <class T>
+    class StrideWrapper
+    {
+    public:
+        // Constructor
+
+        constexpr StrideWrapper(T* first, std::size_t count, std::size_t step) noexcept;
+
+        // Member Functions
+
+        constexpr std::size_t Count() const noexcept;
+
+        /// @brief Views `count` of the viewed items from `offset` on. Throws std::out_of_range if they are not all within this view.
+        constexpr StrideWrapper<T> Slice(std::size_t offset, std::size_t count) const;
+
+        constexpr std::size_t Step() const noexcept;
+
+        // Operators
+
+        constexpr T& operator[](std::size_t index);
+        constexpr const T& operator[](std::size_t index) const;
+
+        // Iterators
+
+        constexpr _StrideIterator<T> begin() noexcept;
+        constexpr _StrideIterator<const T> begin() const noexcept;
+        constexpr _StrideIterator<T> end() noexcept;
+        constexpr _StrideIterator<const T> end() const noexcept;
+    private:
+        T* _First;
+        std::size_t _Count, _Step;
+    };
+
+    /// @brief View of an IterWrapper<T> as consecutive IterWrapper<T>s of a given size, made by IterWrapper<T>::Chunk, e.g. to
+    /// hand out batches of items.
+    /// @tparam T Type of object(s) to be iterated upon
+    template <class T>
+    class ChunkWrapper
+    {
+    public:
+        // Constructor
+
+        constexpr ChunkWrapper(T* first, T* last, std::size_t size) noexcept;
+
+        // Member Functions
+
+        /// @brief Number of chunks.
+        constexpr std::size_t Count() const noexcept;
+
+        constexpr std::size_t Size() const noexcept;
+
+        // Operators
+
+        constexpr IterWrapper<T> operator[](std::size_t index) const;
+
+        // Iterators
+
+        constexpr _ChunkIterator<T> begin() const noexcept;
+        constexpr _ChunkIterator<T> end() const noexcept;
+    private:
+        T* _First, * _Last;
+        std::size_t _Size;
+    };
 };
 
 // ######################################## BODY DECLARATIONS #########################################
 
 namespace CQue::Container
 {
-    template <std::equality_comparable T, ForwardIterableObjectOf<T> _Container>
-    constexpr bool Exists(const _Container& container, Predicate<const T&> match)
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t BinarySearch(const _Container& container, const T& what, _Compare compare)
     {
-        for(const auto& x : container)
-            if(match(x)) return true;
+        std::size_t index = LowerBound<T, _Container, _Compare>(container, what, compare);
+
+        if (index != static_cast<std::size_t>(container.end() - container.begin()) && !std::invoke(compare, what, *(container.begin() + index)))
+            return index;
+
+        return ~index;
+    }
+
+    template <class T, ForwardIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr bool Exists(const _Container& container, _Predicate match)
+    {
+        for (const auto& x : container)
+            if (std::invoke(match, x)) return true;
 
         return false;
     }
 
     template <class T, ForwardIterableObjectOf<T> _Container>
-    constexpr T Find(const _Container& container, Predicate<const T&> match)
+    constexpr bool Exists(const _Container& container, Predicate<const T&> match)
     {
-        for(const auto& x : container)
-            if(match(x)) return x;
-
-        return T();
+        return Exists<T, _Container, Predicate<const T&>>(container, match);
     }
 
-    template <class T, ForwardIterableObjectOf<T> _Container, ForwardIterableObjectOf<T> _OutputContainer>
-    constexpr _OutputContainer FindAll(const _Container& container, Predicate<const T&> match)
+    template <class T, ForwardIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr T Find(const _Container& container, _Predicate match)
     {
-        std::size_t full_size = static_cast<std::size_t>(container.end() - container.begin());
+        for (const auto& x : container)
+            if (std::invoke(match, x)) return x;
 
-        T* _Tmp = std::allocator<T>{}.allocate(full_size);
+        return T();
+    }
 
-        std::size_t nfound = 0;
-        for(const auto& x : container)
-            if(match(x))
-                std::construct_at(&_Tmp[nfound++], x);
+    template <class T, ForwardIterableObjectOf<T> _Container>
+    constexpr T Find(const _Container& container, Predicate<const T&> match)
+    {
+        return Find<T, _Container, Predicate<const T&>>(container, match);
+    }
 
+    template <class T, ForwardIterableObjectOf<T> _Container, ForwardIterableObjectOf<T> _OutputContainer, std::predicate<const T&> _Predicate>
+    constexpr _OutputContainer FindAll(const _Container& container, _Predicate match)
+    {
         _OutputContainer out;
 
-        if constexpr (std::is_constructible_v<_OutputContainer, T*, T*>)
-            out = _OutputContainer(_Tmp, &_Tmp[nfound]);
-        else
+        // Matches are appended straight to the output container with whatever member it offers for that
+        if constexpr (requires(_OutputContainer& c, const T& x) { c.Add(x); })
         {
-            out = _OutputContainer{};
-            std::copy(_Tmp, &_Tmp[nfound], out.begin());
+            for (const auto& x : container)
+                if (std::invoke(match, x))
+                    out.Add(x);
         }
+        else if constexpr (requires(_OutputContainer& c, const T& x) { c.push_back(x); })
+            FindAll<T>(container, match, std::back_inserter(out));
+        else
+            FindAll<T>(container, match, std::inserter(out, out.end()));
 
-        std::allocator<T>{}.deallocate(_Tmp, full_size);
         return out;
     }
 
-    template <class T, ForwardIterableObjectOf<T> _Container>
-    constexpr std::size_t FindIndex(const _Container& container, Predicate<const T&> match)
+    template <class T, ForwardIterableObjectOf<T> _Container, ForwardIterableObjectOf<T> _OutputContainer>
+    constexpr _OutputContainer FindAll(const _Container& container, Predicate<const T&> match)
     {
-        for (std::size_t i = 0; i < static_cast<std::size_t>(container.end() - container.begin()); i++)
-            if (match(*(container.begin() + i)))
-                return i;
+        return FindAll<T, _Container, _OutputContainer, Predicate<const T&>>(container, match);
+    }
+
+    template <class T, ForwardIterableObjectOf<T> _Container, std::output_iterator<const T&> _OutputIterator, std::predicate<const T&> _Predicate>
+    constexpr _OutputIterator FindAll(const _Container& container, _Predicate match, _OutputIterator out)
+    {
+        for (const auto& x : container)
+            if (std::invoke(match, x))
+                *out++ = x;
+
+        return out;
+    }
+
+    template <class T, ForwardIterableObjectOf<T> _Container, std::output_iterator<const T&> _OutputIterator>
+    constexpr _OutputIterator FindAll(const _Container& container, Predicate<const T&> match, _OutputIterator out)
+    {
+        return FindAll<T, _Container, _OutputIterator, Predicate<const T&>>(container, match, out);
+    }
+
+    template <class T, ForwardIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr std::size_t FindIndex(const _Container& container, _Predicate match)
+    {
+        std::size_t index = 0;
+        for (auto iterator = container.begin(), last = container.end(); iterator != last; ++iterator, ++index)
+            if (std::invoke(match, *iterator))
+                return index;
 
         return (std::size_t)(-1);
     }
 
     template <class T, ForwardIterableObjectOf<T> _Container>
-    constexpr T FindLast(const _Container& container, Predicate<const T&> match)
+    constexpr std::size_t FindIndex(const _Container& container, Predicate<const T&> match)
+    {
+        return FindIndex<T, _Container, Predicate<const T&>>(container, match);
+    }
+
+    template <class T, BidirectionalIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr T FindLast(const _Container& container, _Predicate match)
     {
-        std::size_t count = static_cast<std::size_t>(container.end() - container.begin());
-        for (std::size_t i = 0; i < count; i++)
-            if (match(*(container.begin() + count - i - 1)))
-                return *(container.begin() + count - i - 1);
+        for (auto first = container.begin(), iterator = container.end(); iterator != first;)
+            if (std::invoke(match, *--iterator))
+                return *iterator;
 
         return T();
     }
 
     template <class T, BidirectionalIterableObjectOf<T> _Container>
-    constexpr std::size_t FindLastIndex(const _Container& container, Predicate<const T&> match)
+    constexpr T FindLast(const _Container& container, Predicate<const T&> match)
     {
-        for (auto iterator = container.end()-1; iterator >= container.begin(); iterator--)
-            if (match(*iterator))
-                return static_cast<std::size_t>(iterator - container.begin());
+        return FindLast<T, _Container, Predicate<const T&>>(container, match);
+    }
+
+    template <class T, BidirectionalIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    constexpr std::size_t FindLastIndex(const _Container& container, _Predicate match)
+    {
+        for (auto first = container.begin(), iterator = container.end(); iterator != first;)
+            if (std::invoke(match, *--iterator))
+                return static_cast<std::size_t>(std::distance(first, iterator));
 
         return (std::size_t)(-1);
     }
 
-    template <std::equality_comparable T, ForwardIterableObjectOf<T> _Iterable>
-    constexpr std::size_t IndexOf(const _Iterable& container, const T& what) noexcept(noexcept(std::declval<T>() == std::declval<T>()))
+    template <class T, BidirectionalIterableObjectOf<T> _Container>
+    constexpr std::size_t FindLastIndex(const _Container& container, Predicate<const T&> match)
     {
-        for(auto iterator = container.begin(); iterator < container.end(); iterator++)
-            if(*iterator == what)
-                return static_cast<std::size_t>(iterator - container.begin());
+        return FindLastIndex<T, _Container, Predicate<const T&>>(container, match);
+    }
+
+    template <std::equality_comparable T, ForwardIterableObjectOf<T> _Container>
+    constexpr std::size_t IndexOf(const _Container& container, const T& what) noexcept(noexcept(std::declval<T>() == std::declval<T>()))
+    {
+        // Contiguous arithmetic items are searched with the vector kernels of Simd.hpp outside of constant evaluation
+        if constexpr (Simd::is_vectorizable_v<T> && std::contiguous_iterator<decltype(container.begin())>)
+        {
+            if (!std::is_constant_evaluated())
+                return Simd::IndexOf<T>(std::to_address(container.begin()), static_cast<std::size_t>(container.end() - container.begin()), what);
+        }
+
+        std::size_t index = 0;
+        for (auto iterator = container.begin(), last = container.end(); iterator != last; ++iterator, ++index)
+            if (*iterator == what)
+                return index;
 
         return (std::size_t)(-1);
     }
 
-    template <std::equality_comparable T, ForwardIterableObjectOf<T> _Iterable>
-    constexpr std::size_t LastIndexOf(const _Iterable& lst, const T& what) noexcept(noexcept(std::declval<T>() == std::declval<T>()))
+    template <std::equality_comparable T, BidirectionalIterableObjectOf<T> _Container>
+    constexpr std::size_t LastIndexOf(const _Container& container, const T& what) noexcept(noexcept(std::declval<T>() == std::declval<T>()))
     {
-        std::size_t count = static_cast<std::size_t>(lst.end() - lst.begin());
-        for (std::size_t i = 0; i < count; i++)
-            if (*(lst.begin() + count - i - 1) == what)
-                return count - i - 1;
+        if constexpr (Simd::is_vectorizable_v<T> && std::contiguous_iterator<decltype(container.begin())>)
+        {
+            if (!std::is_constant_evaluated())
+                return Simd::LastIndexOf<T>(std::to_address(container.begin()), static_cast<std::size_t>(container.end() - container.begin()), what);
+        }
+
+        for (auto first = container.begin(), iterator = container.end(); iterator != first;)
+            if (*--iterator == what)
+                return static_cast<std::size_t>(std::distance(first, iterator));
 
         return (std::size_t)(-1);
     }
 
+    // The bounds halve the range without branching on the comparison, which the compiler turns into a conditional move for
+    // arithmetic items: a mispredicted branch per step costs more than the extra comparison at the end. Without a branch to
+    // speculate on, the processor no longer loads ahead by itself, so both items the next step may compare are prefetched.
+    // See Khuong and Morin, "Array Layouts for Comparison-Based Searching".
+
+    template <std::random_access_iterator _It>
+    constexpr void _PrefetchHalves([[maybe_unused]] _It base, [[maybe_unused]] std::size_t half) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr (std::contiguous_iterator<_It>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                __builtin_prefetch(std::to_address(base + half / 2));
+                __builtin_prefetch(std::to_address(base + half + half / 2));
+            }
+        }
+#endif
+    }
+
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t LowerBound(const _Container& container, const T& what, _Compare compare)
+    {
+        auto first = container.begin();
+        std::size_t length = static_cast<std::size_t>(container.end() - first);
+        if (length == 0)
+            return 0;
+
+        auto base = first;
+        while (length > 1)
+        {
+            std::size_t half = length / 2;
+            _PrefetchHalves(base, half);
+
+            base = std::invoke(compare, *(base + half), what) ? base + half : base;
+            length -= half;
+        }
+
+        return static_cast<std::size_t>(base - first) + std::invoke(compare, *base, what);
+    }
+
+    template <class T, ForwardIterableObjectOf<T> _First, ForwardIterableObjectOf<T> _Second, std::output_iterator<const T&> _OutputIterator, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr _OutputIterator MergeSorted(const _First& first, const _Second& second, _OutputIterator out, _Compare compare)
+    {
+        auto a = first.begin(), a_last = first.end();
+        auto b = second.begin(), b_last = second.end();
+
+        while (a != a_last && b != b_last)
+        {
+            if (std::invoke(compare, *b, *a))
+                *out++ = *b++;
+            else
+                *out++ = *a++;
+        }
+
+        for (; a != a_last; ++a)
+            *out++ = *a;
+        for (; b != b_last; ++b)
+            *out++ = *b;
+
+        return out;
+    }
+
     template <RandomAccessIterable _Container>
     constexpr void Reverse(_Container& container)
     {
-        std::size_t count = static_cast<std::size_t>(container.end() - container.begin());
+        auto first = container.begin();
+        std::size_t count = static_cast<std::size_t>(container.end() - first);
 
         for (std::size_t i = 0; i < count / 2; i++)
-            *(container.begin() + i) = std::exchange(*(container.begin() + count - i - 1), *(container.begin() + i));
+            *(first + i) = std::exchange(*(first + count - i - 1), *(first + i));
     }
 
     template <RandomAccessIterable _Container, class T>
-    constexpr void Sort(_Container& container, Comparison<T> compare)
+    constexpr void Sort(_Container& container)
     {
-        std::size_t end = static_cast<std::size_t>(container.end() - container.begin());
+        Sort<_Container, T, DefaultComparer<T>>(container, DefaultComparer<T>{});
+    }
+
+    // Sorting engine: pattern-defeating quicksort after Orson Peters' pdqsort. Quicksort on a median-of-3 (ninther for large 
+    // ranges) pivot, insertion sort below a threshold, a quick check for already partitioned runs, pattern breaking swaps when 
+    // a partition turns out badly unbalanced, and heapsort once that has happened log2(n) times, which bounds it to O(n log n).
+    // Arithmetic keys under a default comparer are partitioned branch-free in blocks after Edelkamp and Weiss' BlockQuicksort.
+
+    inline constexpr std::size_t _InsertionSortThreshold = 24;
+    inline constexpr std::size_t _NintherThreshold = 128;
+    inline constexpr std::size_t _PartialInsertionSortLimit = 8;
+    inline constexpr std::size_t _PartitionBlockSize = 64;
+
+    template <class _Compare, class T>
+    inline constexpr bool _IsBranchlessSortable = std::is_arithmetic_v<T> && (std::same_as<_Compare, DefaultComparer<T>> || std::same_as<_Compare, std::less<T>> ||
+        std::same_as<_Compare, std::greater<T>> || std::same_as<_Compare, std::less<>> || std::same_as<_Compare, std::greater<>>);
+
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr void _HeapSort(_It first, _It last, _Compare& compare)
+    {
+        std::size_t end = static_cast<std::size_t>(last - first);
         std::size_t start = end / 2;
-        
+
         while (end > 1)
         {
             if (start > 0)
@@ -193,19 +516,19 @@ namespace CQue::Container
             else
             {
                 end--;
-                *(container.begin() + end) = std::exchange(*container.begin(), *(container.begin() + end));
+                std::ranges::iter_swap(first, first + end);
             }
 
             std::size_t root = start;
             while (root * 2 + 1 < end)
             {
                 std::size_t child = root * 2 + 1;
-                if (child + 1 < end && compare(*(container.begin() + child), *(container.begin() + child + 1)) == std::partial_ordering::less)
+                if (child + 1 < end && std::invoke(compare, *(first + child), *(first + child + 1)))
                     child++;
 
-                if (*(container.begin() + root) < *(container.begin() + child))
+                if (std::invoke(compare, *(first + root), *(first + child)))
                 {
-                    *(container.begin() + root) = std::exchange(*(container.begin() + child), *(container.begin() + root));
+                    std::ranges::iter_swap(first + root, first + child);
                     root = child;
                 }
                 else
@@ -213,6 +536,439 @@ namespace CQue::Container
             }
         }
     }
+
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr void _InsertionSort(_It first, _It last, _Compare& compare)
+    {
+        if (first == last)
+            return;
+
+        for (_It current = first + 1; current != last; ++current)
+        {
+            _It sift = current;
+            _It before = current - 1;
+
+            if (std::invoke(compare, *sift, *before))
+            {
+                std::iter_value_t<_It> item = std::ranges::iter_move(sift);
+
+                do
+                    *sift-- = std::ranges::iter_move(before);
+                while (sift != first && std::invoke(compare, item, *--before));
+
+                *sift = std::move(item);
+            }
+        }
+    }
+
+    // Only valid if the item before first is not greater than any item in [first, last), which spares the bounds check
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr void _UnguardedInsertionSort(_It first, _It last, _Compare& compare)
+    {
+        if (first == last)
+            return;
+
+        for (_It current = first + 1; current != last; ++current)
+        {
+            _It sift = current;
+            _It before = current - 1;
+
+            if (std::invoke(compare, *sift, *before))
+            {
+                std::iter_value_t<_It> item = std::ranges::iter_move(sift);
+
+                do
+                    *sift-- = std::ranges::iter_move(before);
+                while (std::invoke(compare, item, *--before));
+
+                *sift = std::move(item);
+            }
+        }
+    }
+
+    // Insertion sort which gives up once more than _PartialInsertionSortLimit items had to be moved; returns whether it finished
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr bool _PartialInsertionSort(_It first, _It last, _Compare& compare)
+    {
+        if (first == last)
+            return true;
+
+        std::size_t moved = 0;
+        for (_It current = first + 1; current != last; ++current)
+        {
+            if (moved > _PartialInsertionSortLimit)
+                return false;
+
+            _It sift = current;
+            _It before = current - 1;
+
+            if (std::invoke(compare, *sift, *before))
+            {
+                std::iter_value_t<_It> item = std::ranges::iter_move(sift);
+
+                do
+                    *sift-- = std::ranges::iter_move(before);
+                while (sift != first && std::invoke(compare, item, *--before));
+
+                *sift = std::move(item);
+                moved += static_cast<std::size_t>(current - sift);
+            }
+        }
+
+        return true;
+    }
+
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr void _Sort2(_It a, _It b, _Compare& compare)
+    {
+        if (std::invoke(compare, *b, *a))
+            std::ranges::iter_swap(a, b);
+    }
+
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr void _Sort3(_It a, _It b, _It c, _Compare& compare)
+    {
+        _Sort2(a, b, compare);
+        _Sort2(b, c, compare);
+        _Sort2(a, b, compare);
+    }
+
+    // Partitions [first, last) around the pivot at first, putting items equal to the pivot to the right. Returns the final 
+    // position of the pivot and whether the range was already partitioned.
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr std::pair<_It, bool> _PartitionRight(_It first, _It last, _Compare& compare)
+    {
+        std::iter_value_t<_It> pivot = std::ranges::iter_move(first);
+
+        _It left = first;
+        _It right = last;
+
+        // The median-of-3 pivot selection guarantees that these scans stop within bounds
+        while (std::invoke(compare, *++left, pivot));
+
+        if (left - 1 == first)
+            while (left < right && !std::invoke(compare, *--right, pivot));
+        else
+            while (!std::invoke(compare, *--right, pivot));
+
+        bool already_partitioned = left >= right;
+
+        while (left < right)
+        {
+            std::ranges::iter_swap(left, right);
+            while (std::invoke(compare, *++left, pivot));
+            while (!std::invoke(compare, *--right, pivot));
+        }
+
+        _It pivot_pos = left - 1;
+        *first = std::ranges::iter_move(pivot_pos);
+        *pivot_pos = std::move(pivot);
+
+        return { pivot_pos, already_partitioned };
+    }
+
+    // Swaps the items at first + offsets_l[i] and last - offsets_r[i] for i < n; a cyclic permutation is cheaper when the 
+    // offsets do not pair up exactly
+    template <std::random_access_iterator _It>
+    constexpr void _SwapOffsets(_It first, _It last, const unsigned char* offsets_l, const unsigned char* offsets_r, std::size_t n, bool use_swaps)
+    {
+        if (use_swaps)
+        {
+            for (std::size_t i = 0; i < n; i++)
+                std::ranges::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+        }
+        else if (n > 0)
+        {
+            _It l = first + offsets_l[0];
+            _It r = last - offsets_r[0];
+
+            std::iter_value_t<_It> item = std::ranges::iter_move(l);
+            *l = std::ranges::iter_move(r);
+
+            for (std::size_t i = 1; i < n; i++)
+            {
+                l = first + offsets_l[i];
+                *r = std::ranges::iter_move(l);
+                r = last - offsets_r[i];
+                *l = std::ranges::iter_move(r);
+            }
+
+            *r = std::move(item);
+        }
+    }
+
+    // Same contract as _PartitionRight. The items on the wrong side are first collected block by block as offsets without any 
+    // data-dependent branches, then swapped pairwise.
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr std::pair<_It, bool> _PartitionRightBranchless(_It first, _It last, _Compare& compare)
+    {
+        std::iter_value_t<_It> pivot = std::ranges::iter_move(first);
+
+        _It left = first;
+        _It right = last;
+
+        while (std::invoke(compare, *++left, pivot));
+
+        if (left - 1 == first)
+            while (left < right && !std::invoke(compare, *--right, pivot));
+        else
+            while (!std::invoke(compare, *--right, pivot));
+
+        bool already_partitioned = left >= right;
+
+        if (!already_partitioned)
+        {
+            std::ranges::iter_swap(left, right);
+            ++left;
+
+            unsigned char offsets_l[_PartitionBlockSize];
+            unsigned char offsets_r[_PartitionBlockSize];
+
+            _It base_l = left;
+            _It base_r = right;
+            std::size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+            while (left < right)
+            {
+                // Split the remaining items between the two sides, giving everything to a side whose block is still unfinished
+                std::size_t num_unknown = static_cast<std::size_t>(right - left);
+                std::size_t left_split = (num_l == 0) ? ((num_r == 0) ? num_unknown / 2 : num_unknown) : 0;
+                std::size_t right_split = (num_r == 0) ? (num_unknown - left_split) : 0;
+
+                std::size_t count_l = std::min(left_split, _PartitionBlockSize);
+                for (std::size_t i = 0; i < count_l; i++)
+                {
+                    offsets_l[num_l] = static_cast<unsigned char>(i);
+                    num_l += !std::invoke(compare, *left, pivot);
+                    ++left;
+                }
+
+                std::size_t count_r = std::min(right_split, _PartitionBlockSize);
+                for (std::size_t i = 0; i < count_r;)
+                {
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += std::invoke(compare, *--right, pivot);
+                }
+
+                std::size_t n = std::min(num_l, num_r);
+                _SwapOffsets(base_l, base_r, offsets_l + start_l, offsets_r + start_r, n, num_l == num_r);
+
+                num_l -= n;
+                num_r -= n;
+                start_l += n;
+                start_r += n;
+
+                if (num_l == 0)
+                {
+                    start_l = 0;
+                    base_l = left;
+                }
+
+                if (num_r == 0)
+                {
+                    start_r = 0;
+                    base_r = right;
+                }
+            }
+
+            // Whatever is left over in one of the blocks is moved to the boundary
+            if (num_l)
+            {
+                while (num_l--)
+                    std::ranges::iter_swap(base_l + offsets_l[start_l + num_l], --right);
+
+                left = right;
+            }
+
+            if (num_r)
+            {
+                while (num_r--)
+                {
+                    std::ranges::iter_swap(base_r - offsets_r[start_r + num_r], left);
+                    ++left;
+                }
+
+                right = left;
+            }
+        }
+
+        _It pivot_pos = left - 1;
+        *first = std::ranges::iter_move(pivot_pos);
+        *pivot_pos = std::move(pivot);
+
+        return { pivot_pos, already_partitioned };
+    }
+
+    // Partitions [first, last) around the pivot at first, putting items equal to the pivot to the left. Used when the pivot 
+    // equals the item before the range, in which case all of those equal items are in their final place.
+    template <std::random_access_iterator _It, class _Compare>
+    constexpr _It _PartitionLeft(_It first, _It last, _Compare& compare)
+    {
+        std::iter_value_t<_It> pivot = std::ranges::iter_move(first);
+
+        _It left = first;
+        _It right = last;
+
+        while (std::invoke(compare, pivot, *--right));
+
+        if (right + 1 == last)
+            while (left < right && !std::invoke(compare, pivot, *++left));
+        else
+            while (!std::invoke(compare, pivot, *++left));
+
+        while (left < right)
+        {
+            std::ranges::iter_swap(left, right);
+            while (std::invoke(compare, pivot, *--right));
+            while (!std::invoke(compare, pivot, *++left));
+        }
+
+        *first = std::ranges::iter_move(right);
+        *right = std::move(pivot);
+
+        return right;
+    }
+
+    template <bool _Branchless, std::random_access_iterator _It, class _Compare>
+    constexpr void _PdqSortLoop(_It first, _It last, _Compare& compare, int bad_allowed, bool leftmost)
+    {
+        while (true)
+        {
+            std::size_t size = static_cast<std::size_t>(last - first);
+
+            if (size < _InsertionSortThreshold)
+            {
+                if (leftmost)
+                    _InsertionSort(first, last, compare);
+                else
+                    _UnguardedInsertionSort(first, last, compare);
+
+                return;
+            }
+
+            // Moves the chosen pivot to first
+            std::size_t half = size / 2;
+            if (size > _NintherThreshold)
+            {
+                _Sort3(first, first + half, last - 1, compare);
+                _Sort3(first + 1, first + (half - 1), last - 2, compare);
+                _Sort3(first + 2, first + (half + 1), last - 3, compare);
+                _Sort3(first + (half - 1), first + half, first + (half + 1), compare);
+                std::ranges::iter_swap(first, first + half);
+            }
+            else
+                _Sort3(first + half, first, last - 1, compare);
+
+            // The pivot equals the item before the range, which is no greater than anything in it, hence no item is less than the
+            // pivot; putting the equal ones to the left finishes them off
+            if (!leftmost && !std::invoke(compare, *(first - 1), *first))
+            {
+                first = _PartitionLeft(first, last, compare) + 1;
+                continue;
+            }
+
+            auto [pivot_pos, already_partitioned] = _Branchless ? _PartitionRightBranchless(first, last, compare) : _PartitionRight(first, last, compare);
+
+            std::size_t l_size = static_cast<std::size_t>(pivot_pos - first);
+            std::size_t r_size = static_cast<std::size_t>(last - (pivot_pos + 1));
+
+            if (l_size < size / 8 || r_size < size / 8)
+            {
+                if (--bad_allowed == 0)
+                {
+                    _HeapSort(first, last, compare);
+                    return;
+                }
+
+                // Shuffle a few items around in both halves in the hope of breaking up whatever pattern caused this
+                if (l_size >= _InsertionSortThreshold)
+                {
+                    std::ranges::iter_swap(first, first + l_size / 4);
+                    std::ranges::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+                    if (l_size > _NintherThreshold)
+                    {
+                        std::ranges::iter_swap(first + 1, first + (l_size / 4 + 1));
+                        std::ranges::iter_swap(first + 2, first + (l_size / 4 + 2));
+                        std::ranges::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                        std::ranges::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                    }
+                }
+
+                if (r_size >= _InsertionSortThreshold)
+                {
+                    std::ranges::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                    std::ranges::iter_swap(last - 1, last - r_size / 4);
+
+                    if (r_size > _NintherThreshold)
+                    {
+                        std::ranges::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                        std::ranges::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                        std::ranges::iter_swap(last - 2, last - (1 + r_size / 4));
+                        std::ranges::iter_swap(last - 3, last - (2 + r_size / 4));
+                    }
+                }
+            }
+            // A well-balanced partition that needed no swaps hints at sorted input, which insertion sort finishes in linear time
+            else if (already_partitioned && _PartialInsertionSort(first, pivot_pos, compare) && _PartialInsertionSort(pivot_pos + 1, last, compare))
+                return;
+
+            // Recurse into the left part and loop on the right one
+            _PdqSortLoop<_Branchless>(first, pivot_pos, compare, bad_allowed, leftmost);
+            first = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+
+    template <class T, std::random_access_iterator _It, class _Compare>
+    constexpr void _SortRange(_It first, _It last, _Compare& compare)
+    {
+        std::size_t size = static_cast<std::size_t>(last - first);
+        if (size < 2)
+            return;
+
+        _PdqSortLoop<_IsBranchlessSortable<_Compare, T>>(first, last, compare, static_cast<int>(std::bit_width(size)), true);
+    }
+
+    template <RandomAccessIterable _Container, class T, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void Sort(_Container& container, _Compare compare)
+    {
+        _SortRange<T>(container.begin(), container.end(), compare);
+    }
+
+    template <RandomAccessIterable _Container, class T, ThreeWayComparison<T> _Compare>
+    constexpr void Sort(_Container& container, _Compare compare)
+    {
+        auto less = [&compare](const T& a, const T& b) -> bool { return std::invoke(compare, a, b) < 0; };
+        Sort<_Container, T, decltype(less)>(container, less);
+    }
+
+    template <RandomAccessIterable _Container, class T>
+    constexpr void Sort(_Container& container, Comparison<T> compare)
+    {
+        Sort<_Container, T, Comparison<T>>(container, compare);
+    }
+
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t UpperBound(const _Container& container, const T& what, _Compare compare)
+    {
+        auto first = container.begin();
+        std::size_t length = static_cast<std::size_t>(container.end() - first);
+        if (length == 0)
+            return 0;
+
+        auto base = first;
+        while (length > 1)
+        {
+            std::size_t half = length / 2;
+            _PrefetchHalves(base, half);
+
+            base = !std::invoke(compare, what, *(base + half)) ? base + half : base;
+            length -= half;
+        }
+
+        return static_cast<std::size_t>(base - first) + !std::invoke(compare, what, *base);
+    }
 };
 
 namespace CQue
@@ -244,6 +1000,119 @@ namespace CQue
         return _Dest;
     }
 
+    /// @brief Moves the objects in [_First, _Last) into the uninitialized, non-overlapping storage starting at _Dest and destroys 
+    /// the originals. Trivially relocatable types are copied in bulk outside of constant evaluation.
+    template <class T>
+    constexpr T* UninitializedRelocate(T* _First, T* _Last, T* _Dest) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                if (_First != _Last)
+                    std::memcpy(static_cast<void*>(_Dest), static_cast<const void*>(_First), static_cast<std::size_t>(_Last - _First) * sizeof(T));
+
+                return _Dest + (_Last - _First);
+            }
+        }
+
+        for (T* cur = _First; cur < _Last; cur++, _Dest++)
+        {
+            std::construct_at(_Dest, std::move(*cur));
+            std::destroy_at(cur);
+        }
+
+        return _Dest;
+    }
+
+    // ***************************************** _StrideIterator<T> *****************************************
+
+    template <class T>
+    class _StrideIterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_cv_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        constexpr _StrideIterator() noexcept = default;
+        constexpr _StrideIterator(T* first, std::size_t step, std::size_t index) noexcept : _First(first), _Step(static_cast<std::ptrdiff_t>(step)), _Index(static_cast<std::ptrdiff_t>(index)) {}
+
+        // Items are reached from the first one rather than by moving a pointer, which would step past the end of the items
+        constexpr reference operator*() const noexcept { return _First[_Index * _Step]; }
+        constexpr pointer operator->() const noexcept { return _First + _Index * _Step; }
+        constexpr reference operator[](difference_type n) const noexcept { return _First[(_Index + n) * _Step]; }
+
+        constexpr _StrideIterator& operator++() noexcept { ++_Index; return *this; }
+        constexpr _StrideIterator operator++(int) noexcept { _StrideIterator previous = *this; ++_Index; return previous; }
+        constexpr _StrideIterator& operator--() noexcept { --_Index; return *this; }
+        constexpr _StrideIterator operator--(int) noexcept { _StrideIterator previous = *this; --_Index; return previous; }
+
+        constexpr _StrideIterator& operator+=(difference_type n) noexcept { _Index += n; return *this; }
+        constexpr _StrideIterator& operator-=(difference_type n) noexcept { _Index -= n; return *this; }
+
+        constexpr friend _StrideIterator operator+(_StrideIterator it, difference_type n) noexcept { return it += n; }
+        constexpr friend _StrideIterator operator+(difference_type n, _StrideIterator it) noexcept { return it += n; }
+        constexpr friend _StrideIterator operator-(_StrideIterator it, difference_type n) noexcept { return it -= n; }
+        constexpr friend difference_type operator-(const _StrideIterator& a, const _StrideIterator& b) noexcept { return a._Index - b._Index; }
+
+        constexpr bool operator==(const _StrideIterator& other) const noexcept { return (_Index == other._Index); }
+        constexpr auto operator<=>(const _StrideIterator& other) const noexcept { return (_Index <=> other._Index); }
+
+    private:
+        T* _First = nullptr;
+        std::ptrdiff_t _Step = 1;
+        std::ptrdiff_t _Index = 0;
+    };
+
+    // ***************************************** _ChunkIterator<T> ******************************************
+
+    template <class T>
+    class _ChunkIterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = IterWrapper<T>;
+        using difference_type = std::ptrdiff_t;
+        using reference = IterWrapper<T>;
+
+        constexpr _ChunkIterator() noexcept = default;
+        constexpr _ChunkIterator(T* first, T* last, std::size_t size, std::size_t index) noexcept : _First(first), _Last(last), _Size(static_cast<std::ptrdiff_t>(size)), _Index(static_cast<std::ptrdiff_t>(index)) {}
+
+        constexpr reference operator*() const noexcept { return (*this)[0]; }
+
+        constexpr reference operator[](difference_type n) const noexcept
+        {
+            T* first = _First + (_Index + n) * _Size;
+            return reference(first, (_Last - first > _Size) ? first + _Size : _Last);
+        }
+
+        constexpr _ChunkIterator& operator++() noexcept { ++_Index; return *this; }
+        constexpr _ChunkIterator operator++(int) noexcept { _ChunkIterator previous = *this; ++_Index; return previous; }
+        constexpr _ChunkIterator& operator--() noexcept { --_Index; return *this; }
+        constexpr _ChunkIterator operator--(int) noexcept { _ChunkIterator previous = *this; --_Index; return previous; }
+
+        constexpr _ChunkIterator& operator+=(difference_type n) noexcept { _Index += n; return *this; }
+        constexpr _ChunkIterator& operator-=(difference_type n) noexcept { _Index -= n; return *this; }
+
+        constexpr friend _ChunkIterator operator+(_ChunkIterator it, difference_type n) noexcept { return it += n; }
+        constexpr friend _ChunkIterator operator+(difference_type n, _ChunkIterator it) noexcept { return it += n; }
+        constexpr friend _ChunkIterator operator-(_ChunkIterator it, difference_type n) noexcept { return it -= n; }
+        constexpr friend difference_type operator-(const _ChunkIterator& a, const _ChunkIterator& b) noexcept { return a._Index - b._Index; }
+
+        constexpr bool operator==(const _ChunkIterator& other) const noexcept { return (_Index == other._Index); }
+        constexpr auto operator<=>(const _ChunkIterator& other) const noexcept { return (_Index <=> other._Index); }
+
+    private:
+        T* _First = nullptr, * _Last = nullptr;
+        std::ptrdiff_t _Size = 1;
+        std::ptrdiff_t _Index = 0;
+    };
+
     // ****************************************** IterWrapper<T> ******************************************
 
 #if 1
@@ -256,14 +1125,195 @@ namespace CQue
     template <ForwardIterableObjectOf<T> _It>
     constexpr IterWrapper<T>::IterWrapper(const _It& iter) noexcept : _First((T*)iter.begin()), _Last((T*)iter.end()) {}
 
+    // IterWrapper<T> - Member Functions
+
+    template <class T>
+    constexpr ChunkWrapper<T> IterWrapper<T>::Chunk(std::size_t size) const
+    {
+        if (size == 0)
+            throw std::invalid_argument("size");
+
+        // Sizes past the number of items make a single chunk just the same, and clamped, stay within what the iterators' signed
+        // arithmetic can hold
+        return ChunkWrapper<T>(_First, _Last, std::min(size, std::max<std::size_t>(Count(), 1)));
+    }
+
+    template <class T>
+    constexpr std::size_t IterWrapper<T>::Count() const noexcept
+    {
+        return static_cast<std::size_t>(_Last - _First);
+    }
+
+    template <class T>
+    constexpr IterWrapper<T> IterWrapper<T>::Slice(std::size_t offset, std::size_t count) const
+    {
+        if (offset > Count())
+            throw std::out_of_range("offset");
+        if (count > Count() - offset)
+            throw std::out_of_range("count");
+
+        return IterWrapper<T>(_First + offset, _First + offset + count);
+    }
+
+    template <class T>
+    constexpr StrideWrapper<T> IterWrapper<T>::Stride(std::size_t step) const
+    {
+        if (step == 0)
+            throw std::invalid_argument("step");
+
+        // Steps past the number of items view the first item alone just the same, and clamped, stay within what the iterators'
+        // signed arithmetic can hold
+        std::size_t count = Count();
+        step = std::min(step, std::max<std::size_t>(count, 1));
+
+        return StrideWrapper<T>(_First, count / step + (count % step != 0), step);
+    }
+
+    // IterWrapper<T> - Operators
+
+    template <class T>
+    constexpr T& IterWrapper<T>::operator[](std::size_t index)
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        return _First[index];
+    }
+
+    template <class T>
+    constexpr const T& IterWrapper<T>::operator[](std::size_t index) const
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        return _First[index];
+    }
+
     // IterWrapper<T> - Iterators
 
+    template <class T>
+    constexpr T* IterWrapper<T>::begin() noexcept { return _First; }
+
     template <class T>
     constexpr const T* IterWrapper<T>::begin() const noexcept { return _First; }
 
+    template <class T>
+    constexpr T* IterWrapper<T>::end() noexcept { return _Last; }
+
     template <class T>
     constexpr const T* IterWrapper<T>::end() const noexcept { return _Last; }
 #endif
+
+    // ***************************************** StrideWrapper<T> *****************************************
+
+#if 1
+    // StrideWrapper<T> - Constructors
+
+    template <class T>
+    constexpr StrideWrapper<T>::StrideWrapper(T* first, std::size_t count, std::size_t step) noexcept : _First(first), _Count(count), _Step(step) {}
+
+    // StrideWrapper<T> - Member Functions
+
+    template <class T>
+    constexpr std::size_t StrideWrapper<T>::Count() const noexcept
+    {
+        return _Count;
+    }
+
+    template <class T>
+    constexpr StrideWrapper<T> StrideWrapper<T>::Slice(std::size_t offset, std::size_t count) const
+    {
+        if (offset > _Count)
+            throw std::out_of_range("offset");
+        if (count > _Count - offset)
+            throw std::out_of_range("count");
+
+        return StrideWrapper<T>((count > 0) ? _First + offset * _Step : _First, count, _Step);
+    }
+
+    template <class T>
+    constexpr std::size_t StrideWrapper<T>::Step() const noexcept
+    {
+        return _Step;
+    }
+
+    // StrideWrapper<T> - Operators
+
+    template <class T>
+    constexpr T& StrideWrapper<T>::operator[](std::size_t index)
+    {
+        if (index >= _Count)
+            throw std::out_of_range("index");
+
+        return _First[index * _Step];
+    }
+
+    template <class T>
+    constexpr const T& StrideWrapper<T>::operator[](std::size_t index) const
+    {
+        if (index >= _Count)
+            throw std::out_of_range("index");
+
+        return _First[index * _Step];
+    }
+
+    // StrideWrapper<T> - Iterators
+
+    template <class T>
+    constexpr _StrideIterator<T> StrideWrapper<T>::begin() noexcept { return _StrideIterator<T>(_First, _Step, 0); }
+
+    template <class T>
+    constexpr _StrideIterator<const T> StrideWrapper<T>::begin() const noexcept { return _StrideIterator<const T>(_First, _Step, 0); }
+
+    template <class T>
+    constexpr _StrideIterator<T> StrideWrapper<T>::end() noexcept { return _StrideIterator<T>(_First, _Step, _Count); }
+
+    template <class T>
+    constexpr _StrideIterator<const T> StrideWrapper<T>::end() const noexcept { return _StrideIterator<const T>(_First, _Step, _Count); }
+#endif
+
+    // ***************************************** ChunkWrapper<T> ******************************************
+
+#if 1
+    // ChunkWrapper<T> - Constructors
+
+    template <class T>
+    constexpr ChunkWrapper<T>::ChunkWrapper(T* first, T* last, std::size_t size) noexcept : _First(first), _Last(last), _Size(size) {}
+
+    // ChunkWrapper<T> - Member Functions
+
+    template <class T>
+    constexpr std::size_t ChunkWrapper<T>::Count() const noexcept
+    {
+        std::size_t count = static_cast<std::size_t>(_Last - _First);
+        return count / _Size + (count % _Size != 0);
+    }
+
+    template <class T>
+    constexpr std::size_t ChunkWrapper<T>::Size() const noexcept
+    {
+        return _Size;
+    }
+
+    // ChunkWrapper<T> - Operators
+
+    template <class T>
+    constexpr IterWrapper<T> ChunkWrapper<T>::operator[](std::size_t index) const
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        return begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    // ChunkWrapper<T> - Iterators
+
+    template <class T>
+    constexpr _ChunkIterator<T> ChunkWrapper<T>::begin() const noexcept { return _ChunkIterator<T>(_First, _Last, _Size, 0); }
+
+    template <class T>
+    constexpr _ChunkIterator<T> ChunkWrapper<T>::end() const noexcept { return _ChunkIterator<T>(_First, _Last, _Size, Count()); }
+#endif
 };
 
 #include "List.hpp"
\ No newline at end of file
@@ -0,0 +1,370 @@
+#pragma once
+
+#include "HashTable.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    template <class TKey, class TValue>
+    struct KeyValuePair
+    {
+        TKey Key;
+        TValue Value;
+    };
+
+    // Kept out of the class and constrained, so that pairs of values without a usable operator==, such as Any, stay well-formed
+    template <std::equality_comparable TKey, std::equality_comparable TValue>
+    constexpr bool operator==(const KeyValuePair<TKey, TValue>& a, const KeyValuePair<TKey, TValue>& b);
+
+    template <class TKey, class TValue>
+    struct _PairKeyOf
+    {
+        static const TKey& Get(const KeyValuePair<TKey, TValue>& pair) noexcept { return pair.Key; }
+    };
+
+    /// @brief Hash map from unique keys to values, after .NET's Dictionary<TKey, TValue>. Built on an open-addressing Swiss
+    /// table whose lookups check the control bytes of 16 slots at once with SSE2 (8 at a time without it), so a lookup
+    /// touches one cache line of control bytes and, unless the key is absent, the one slot holding it. Keys are compared with
+    /// operator==. When the hash is transparent, as DefaultHash is for strings, keys can be looked up by any type the hash
+    /// takes, e.g. std::string keys by std::string_view. Iterates over the pairs, read-only and in no particular order; any
+    /// insertion may invalidate iterators and pointers into the dictionary, removal only those to the removed pair.
+    /// Satisfies ForwardIterableObjectOf<KeyValuePair<TKey, TValue>>.
+    /// @tparam TKey Type of the keys
+    /// @tparam TValue Type of the values
+    template <class TKey, class TValue, class Hash = DefaultHash<TKey>, class Allocator = std::allocator<KeyValuePair<TKey, TValue>>>
+    class Dictionary
+    {
+        using _Table = _HashTable<KeyValuePair<TKey, TValue>, TKey, _PairKeyOf<TKey, TValue>, Hash, Allocator>;
+
+    public:
+        using iterator = typename _Table::iterator;
+
+        // Constructors
+
+        Dictionary() noexcept(std::is_nothrow_default_constructible_v<Hash> && std::is_nothrow_default_constructible_v<Allocator>) = default;
+        explicit Dictionary(const Allocator& alloc) noexcept(std::is_nothrow_default_constructible_v<Hash>);
+        explicit Dictionary(std::size_t capacity, const Hash& hash = Hash(), const Allocator& alloc = Allocator());
+        Dictionary(const Dictionary& other) = default;
+        Dictionary(const Dictionary& other, const Allocator& alloc);
+        Dictionary(Dictionary&& other) noexcept = default;
+
+        /// @brief Adds the pairs in order; throws std::invalid_argument on a duplicate key.
+        Dictionary(std::initializer_list<KeyValuePair<TKey, TValue>> lst, const Allocator& alloc = Allocator());
+
+        template <ForwardIterableObjectOf<KeyValuePair<TKey, TValue>> _It>
+        explicit Dictionary(const _It& lst, const Allocator& alloc = Allocator());
+
+        // Non-Template Member Functions
+
+        /// @brief Adds the pair, throwing std::invalid_argument if the key is there already.
+        void Add(const TKey& key, const TValue& value);
+        void Add(TKey&& key, TValue&& value);
+
+        /// @brief Value of the given key, throwing std::out_of_range if it is not there.
+        TValue& At(const TKey& key);
+        const TValue& At(const TKey& key) const;
+
+        std::size_t Capacity() const noexcept;
+        void Clear() noexcept;
+        bool ContainsKey(const TKey& key) const;
+        bool ContainsValue(const TValue& value) const requires std::equality_comparable<TValue>;
+        std::size_t Count() const noexcept;
+        Allocator GetAllocator() const noexcept;
+        bool Remove(const TKey& key);
+
+        /// @brief Makes room for the given number of pairs in total, so that adding up to that many does not rehash.
+        void Reserve(std::size_t count);
+
+        /// @brief Exchanges the contents of two dictionaries. Unless the allocator propagates on swap, both must use equal allocators.
+        void Swap(Dictionary& other) noexcept;
+
+        /// @brief Adds the pair unless the key is there already, and tells whether it did.
+        bool TryAdd(const TKey& key, const TValue& value);
+        bool TryAdd(TKey&& key, TValue&& value);
+
+        /// @brief Copies the value of the given key into `value` and returns true, or returns false if the key is not there.
+        bool TryGetValue(const TKey& key, TValue& value) const;
+
+        // Template Member Functions
+
+        template <class Q> requires TransparentHash<Hash>
+        TValue& At(const Q& key);
+
+        template <class Q> requires TransparentHash<Hash>
+        const TValue& At(const Q& key) const;
+
+        template <class Q> requires TransparentHash<Hash>
+        bool ContainsKey(const Q& key) const;
+
+        template <class Q> requires TransparentHash<Hash>
+        bool Remove(const Q& key);
+
+        /// @brief Adds the key with a value constructed from the arguments unless the key is there already. Returns the value of
+        /// the key and whether it was just added; the arguments are left untouched if it was not.
+        template <class... Args>
+        std::pair<TValue*, bool> TryEmplace(const TKey& key, Args&&... args);
+
+        template <class Q> requires TransparentHash<Hash>
+        bool TryGetValue(const Q& key, TValue& value) const;
+
+        // Iterators
+
+        iterator begin() const noexcept;
+        iterator end() const noexcept;
+
+        // Operators
+
+        Dictionary& operator=(const Dictionary& other) = default;
+        Dictionary& operator=(Dictionary&& other) noexcept(std::allocator_traits<Allocator>::is_always_equal::value || std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) = default;
+
+        /// @brief Value of the given key, adding the key with a value-initialized value if it is not there.
+        TValue& operator[](const TKey& key) requires std::default_initializable<TValue>;
+
+    private:
+        _Table _Items;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ************************************ KeyValuePair<TKey, TValue> ************************************
+
+    template <std::equality_comparable TKey, std::equality_comparable TValue>
+    constexpr bool operator==(const KeyValuePair<TKey, TValue>& a, const KeyValuePair<TKey, TValue>& b)
+    {
+        return (a.Key == b.Key) && (a.Value == b.Value);
+    }
+
+    // **************************** Dictionary<TKey, TValue, Hash, Allocator> *****************************
+
+#if 1
+    // Dictionary<TKey, TValue, Hash, Allocator> - Constructors
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    Dictionary<TKey, TValue, Hash, Allocator>::Dictionary(const Allocator& alloc) noexcept(std::is_nothrow_default_constructible_v<Hash>) : _Items(Hash(), alloc) {}
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    Dictionary<TKey, TValue, Hash, Allocator>::Dictionary(std::size_t capacity, const Hash& hash, const Allocator& alloc) : _Items(hash, alloc)
+    {
+        _Items.Reserve(capacity);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    Dictionary<TKey, TValue, Hash, Allocator>::Dictionary(const Dictionary& other, const Allocator& alloc) : _Items(other._Items, alloc) {}
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    Dictionary<TKey, TValue, Hash, Allocator>::Dictionary(std::initializer_list<KeyValuePair<TKey, TValue>> lst, const Allocator& alloc) : _Items(Hash(), alloc)
+    {
+        _Items.Reserve(lst.size());
+
+        for (const KeyValuePair<TKey, TValue>& pair : lst)
+            Add(pair.Key, pair.Value);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    template <ForwardIterableObjectOf<KeyValuePair<TKey, TValue>> _It>
+    Dictionary<TKey, TValue, Hash, Allocator>::Dictionary(const _It& lst, const Allocator& alloc) : _Items(Hash(), alloc)
+    {
+        if constexpr (std::sized_sentinel_for<decltype(lst.end()), decltype(lst.begin())>)
+            _Items.Reserve(static_cast<std::size_t>(lst.end() - lst.begin()));
+
+        for (const KeyValuePair<TKey, TValue>& pair : lst)
+            Add(pair.Key, pair.Value);
+    }
+
+    // Dictionary<TKey, TValue, Hash, Allocator> - Non-Template Member Functions
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    void Dictionary<TKey, TValue, Hash, Allocator>::Add(const TKey& key, const TValue& value)
+    {
+        if (!TryAdd(key, value))
+            throw std::invalid_argument("key");
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    void Dictionary<TKey, TValue, Hash, Allocator>::Add(TKey&& key, TValue&& value)
+    {
+        if (!TryAdd(std::move(key), std::move(value)))
+            throw std::invalid_argument("key");
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    TValue& Dictionary<TKey, TValue, Hash, Allocator>::At(const TKey& key)
+    {
+        return const_cast<TValue&>(std::as_const(*this).At(key));
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    const TValue& Dictionary<TKey, TValue, Hash, Allocator>::At(const TKey& key) const
+    {
+        KeyValuePair<TKey, TValue>* found = _Items.Find(key);
+        if (!found)
+            throw std::out_of_range("key");
+
+        return found->Value;
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    std::size_t Dictionary<TKey, TValue, Hash, Allocator>::Capacity() const noexcept
+    {
+        return _Items.Capacity();
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    void Dictionary<TKey, TValue, Hash, Allocator>::Clear() noexcept
+    {
+        _Items.Clear();
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::ContainsKey(const TKey& key) const
+    {
+        return (_Items.Find(key) != nullptr);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::ContainsValue(const TValue& value) const requires std::equality_comparable<TValue>
+    {
+        for (const KeyValuePair<TKey, TValue>& pair : _Items)
+            if (pair.Value == value)
+                return true;
+
+        return false;
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    std::size_t Dictionary<TKey, TValue, Hash, Allocator>::Count() const noexcept
+    {
+        return _Items.Count();
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    Allocator Dictionary<TKey, TValue, Hash, Allocator>::GetAllocator() const noexcept
+    {
+        return _Items.GetAllocator();
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::Remove(const TKey& key)
+    {
+        return _Items.Remove(key);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    void Dictionary<TKey, TValue, Hash, Allocator>::Reserve(std::size_t count)
+    {
+        _Items.Reserve(count);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    void Dictionary<TKey, TValue, Hash, Allocator>::Swap(Dictionary& other) noexcept
+    {
+        _Items.Swap(other._Items);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::TryAdd(const TKey& key, const TValue& value)
+    {
+        return _Items.TryEmplace(key, key, value).second;
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::TryAdd(TKey&& key, TValue&& value)
+    {
+        // The key is only moved from once the lookup is done, when the pair gets constructed
+        return _Items.TryEmplace(key, std::move(key), std::move(value)).second;
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::TryGetValue(const TKey& key, TValue& value) const
+    {
+        KeyValuePair<TKey, TValue>* found = _Items.Find(key);
+        if (!found)
+            return false;
+
+        value = found->Value;
+        return true;
+    }
+
+    // Dictionary<TKey, TValue, Hash, Allocator> - Template Member Functions
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    template <class Q> requires TransparentHash<Hash>
+    TValue& Dictionary<TKey, TValue, Hash, Allocator>::At(const Q& key)
+    {
+        return const_cast<TValue&>(std::as_const(*this).At(key));
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    template <class Q> requires TransparentHash<Hash>
+    const TValue& Dictionary<TKey, TValue, Hash, Allocator>::At(const Q& key) const
+    {
+        KeyValuePair<TKey, TValue>* found = _Items.Find(key);
+        if (!found)
+            throw std::out_of_range("key");
+
+        return found->Value;
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    template <class Q> requires TransparentHash<Hash>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::ContainsKey(const Q& key) const
+    {
+        return (_Items.Find(key) != nullptr);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    template <class Q> requires TransparentHash<Hash>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::Remove(const Q& key)
+    {
+        return _Items.Remove(key);
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    template <class... Args>
+    std::pair<TValue*, bool> Dictionary<TKey, TValue, Hash, Allocator>::TryEmplace(const TKey& key, Args&&... args)
+    {
+        // The value is built as part of the pair only on a miss; converting through a proxy instead would let a TValue with an
+        // unconstrained converting constructor, such as std::any, store the proxy itself
+        auto [pair, added] = _Items.TryEmplaceWith(key, [&]() { return KeyValuePair<TKey, TValue>{ key, TValue(std::forward<Args>(args)...) }; });
+        return { &pair->Value, added };
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    template <class Q> requires TransparentHash<Hash>
+    bool Dictionary<TKey, TValue, Hash, Allocator>::TryGetValue(const Q& key, TValue& value) const
+    {
+        KeyValuePair<TKey, TValue>* found = _Items.Find(key);
+        if (!found)
+            return false;
+
+        value = found->Value;
+        return true;
+    }
+
+    // Dictionary<TKey, TValue, Hash, Allocator> - Iterators
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    typename Dictionary<TKey, TValue, Hash, Allocator>::iterator Dictionary<TKey, TValue, Hash, Allocator>::begin() const noexcept
+    {
+        return _Items.begin();
+    }
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    typename Dictionary<TKey, TValue, Hash, Allocator>::iterator Dictionary<TKey, TValue, Hash, Allocator>::end() const noexcept
+    {
+        return _Items.end();
+    }
+
+    // Dictionary<TKey, TValue, Hash, Allocator> - Operators
+
+    template <class TKey, class TValue, class Hash, class Allocator>
+    TValue& Dictionary<TKey, TValue, Hash, Allocator>::operator[](const TKey& key) requires std::default_initializable<TValue>
+    {
+        return *TryEmplace(key).first;
+    }
+#endif
+};
\ No newline at end of file
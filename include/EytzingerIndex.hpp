@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Containers.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief Read-only copy of a sorted sequence laid out in Eytzinger (breadth-first) order: the root of the implicit search
+    /// tree comes first, followed by its two children, their four children, and so on. A lookup walks down the tree without
+    /// branching on the comparisons, and since the items it may touch next sit together in memory, they are prefetched several
+    /// levels ahead. For large read-mostly sequences this beats binary search on the sorted order, whose first steps each miss
+    /// the cache. See Khuong and Morin, "Array Layouts for Comparison-Based Searching".
+    /// @tparam T Type of the items
+    template <class T, class Allocator = std::allocator<T>>
+    class EytzingerIndex
+    {
+    public:
+        // Constructors
+
+        constexpr explicit EytzingerIndex(const Allocator& alloc = Allocator()) noexcept;
+
+        /// @brief Copies the items of a container sorted in the order that lookups are to use.
+        template <RandomAccessIterableObjectOf<T> _Container>
+        constexpr explicit EytzingerIndex(const _Container& sorted, const Allocator& alloc = Allocator());
+
+        // Non-Template Member Functions
+
+        constexpr bool Contains(const T& what) const;
+        constexpr std::size_t Count() const noexcept;
+
+        /// @brief Smallest item not ordered before `what`, or nullptr if there is none.
+        constexpr const T* LowerBound(const T& what) const;
+
+        // Template Member Functions
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr bool Contains(const T& what, _Compare compare) const;
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr const T* LowerBound(const T& what, _Compare compare) const;
+
+    private:
+        template <std::random_access_iterator _It>
+        constexpr _It _Build(_It sorted, std::size_t node);
+
+        // Nodes are numbered from 1 so that the children of node k are 2k and 2k + 1; node k is held at _Items[k - 1]
+        List<T, Allocator> _Items;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // *********************************** EytzingerIndex<T, Allocator> ***********************************
+
+    // EytzingerIndex<T, Allocator> - Constructors
+
+    template <class T, class Allocator>
+    constexpr EytzingerIndex<T, Allocator>::EytzingerIndex(const Allocator& alloc) noexcept : _Items(alloc) {}
+
+    template <class T, class Allocator>
+    template <RandomAccessIterableObjectOf<T> _Container>
+    constexpr EytzingerIndex<T, Allocator>::EytzingerIndex(const _Container& sorted, const Allocator& alloc) : _Items(sorted.begin(), sorted.end(), alloc)
+    {
+        _Build(sorted.begin(), 1);
+    }
+
+    // EytzingerIndex<T, Allocator> - Non-Template Member Functions
+
+    template <class T, class Allocator>
+    constexpr bool EytzingerIndex<T, Allocator>::Contains(const T& what) const
+    {
+        return Contains<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <class T, class Allocator>
+    constexpr std::size_t EytzingerIndex<T, Allocator>::Count() const noexcept
+    {
+        return _Items.Count();
+    }
+
+    template <class T, class Allocator>
+    constexpr const T* EytzingerIndex<T, Allocator>::LowerBound(const T& what) const
+    {
+        return LowerBound<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    // EytzingerIndex<T, Allocator> - Template Member Functions
+
+    template <class T, class Allocator>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr bool EytzingerIndex<T, Allocator>::Contains(const T& what, _Compare compare) const
+    {
+        const T* found = LowerBound<_Compare>(what, compare);
+        return (found && !std::invoke(compare, what, *found));
+    }
+
+    template <class T, class Allocator>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr const T* EytzingerIndex<T, Allocator>::LowerBound(const T& what, _Compare compare) const
+    {
+        // The descendants of node k four levels down are nodes 16k to 16k + 15, which share a cache line or two for small items
+        constexpr std::size_t prefetch_distance = 16;
+
+        const T* items = _Items.begin();
+        const std::size_t count = _Items.Count();
+
+        std::size_t node = 1;
+        while (node <= count)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            // Computed on integers since the address may well lie past the items, which is harmless to prefetch but not to form
+            if (!std::is_constant_evaluated())
+                __builtin_prefetch(reinterpret_cast<const void*>(reinterpret_cast<std::uintptr_t>(items) + (prefetch_distance * node - 1) * sizeof(T)));
+#endif
+            node = 2 * node + std::invoke(compare, items[node - 1], what);
+        }
+
+        // Every step to the right past the answer has to be undone: that is the trailing ones, and then the last step left
+        node >>= std::countr_one(node) + 1;
+
+        return (node != 0) ? &items[node - 1] : nullptr;
+    }
+
+    // EytzingerIndex<T, Allocator> - Private Member Functions
+
+    /// @brief Fills the subtree rooted at the given node with the sorted items from the iterator on, in order, and returns the
+    /// iterator past the last item used.
+    template <class T, class Allocator>
+    template <std::random_access_iterator _It>
+    constexpr _It EytzingerIndex<T, Allocator>::_Build(_It sorted, std::size_t node)
+    {
+        if (node <= _Items.Count())
+        {
+            sorted = _Build(sorted, 2 * node);
+            _Items.UnsafeAt(node - 1) = *sorted++;
+            sorted = _Build(sorted, 2 * node + 1);
+        }
+
+        return sorted;
+    }
+};
\ No newline at end of file
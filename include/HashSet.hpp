@@ -0,0 +1,219 @@
+#pragma once
+
+#include "HashTable.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    template <class T>
+    struct _IdentityKeyOf
+    {
+        static const T& Get(const T& item) noexcept { return item; }
+    };
+
+    /// @brief Set of unique items, after .NET's HashSet<T>, on the same Swiss table as Dictionary<TKey, TValue>: items are
+    /// compared with operator==, looked up by any type a transparent hash takes, and iterated read-only in no particular
+    /// order. Any insertion may invalidate iterators and pointers into the set, removal only those to the removed item.
+    /// Satisfies ForwardIterableObjectOf<T>.
+    /// @tparam T Type of the items
+    template <class T, class Hash = DefaultHash<T>, class Allocator = std::allocator<T>>
+    class HashSet
+    {
+        using _Table = _HashTable<T, T, _IdentityKeyOf<T>, Hash, Allocator>;
+
+    public:
+        using iterator = typename _Table::iterator;
+
+        // Constructors
+
+        HashSet() noexcept(std::is_nothrow_default_constructible_v<Hash> && std::is_nothrow_default_constructible_v<Allocator>) = default;
+        explicit HashSet(const Allocator& alloc) noexcept(std::is_nothrow_default_constructible_v<Hash>);
+        explicit HashSet(std::size_t capacity, const Hash& hash = Hash(), const Allocator& alloc = Allocator());
+        HashSet(const HashSet& other) = default;
+        HashSet(const HashSet& other, const Allocator& alloc);
+        HashSet(HashSet&& other) noexcept = default;
+
+        /// @brief Adds the items in order, skipping duplicates.
+        HashSet(std::initializer_list<T> lst, const Allocator& alloc = Allocator());
+
+        template <ForwardIterableObjectOf<T> _It>
+        explicit HashSet(const _It& lst, const Allocator& alloc = Allocator());
+
+        // Non-Template Member Functions
+
+        /// @brief Adds the item unless it is there already, and tells whether it did.
+        bool Add(const T& what);
+        bool Add(T&& what);
+
+        std::size_t Capacity() const noexcept;
+        void Clear() noexcept;
+        bool Contains(const T& what) const;
+        std::size_t Count() const noexcept;
+        Allocator GetAllocator() const noexcept;
+        bool Remove(const T& what);
+
+        /// @brief Makes room for the given number of items in total, so that adding up to that many does not rehash.
+        void Reserve(std::size_t count);
+
+        /// @brief Exchanges the contents of two sets. Unless the allocator propagates on swap, both must use equal allocators.
+        void Swap(HashSet& other) noexcept;
+
+        // Template Member Functions
+
+        template <class Q> requires TransparentHash<Hash>
+        bool Contains(const Q& what) const;
+
+        template <class Q> requires TransparentHash<Hash>
+        bool Remove(const Q& what);
+
+        // Iterators
+
+        iterator begin() const noexcept;
+        iterator end() const noexcept;
+
+        // Operators
+
+        HashSet& operator=(const HashSet& other) = default;
+        HashSet& operator=(HashSet&& other) noexcept(std::allocator_traits<Allocator>::is_always_equal::value || std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) = default;
+
+    private:
+        _Table _Items;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // *********************************** HashSet<T, Hash, Allocator> ************************************
+
+#if 1
+    // HashSet<T, Hash, Allocator> - Constructors
+
+    template <class T, class Hash, class Allocator>
+    HashSet<T, Hash, Allocator>::HashSet(const Allocator& alloc) noexcept(std::is_nothrow_default_constructible_v<Hash>) : _Items(Hash(), alloc) {}
+
+    template <class T, class Hash, class Allocator>
+    HashSet<T, Hash, Allocator>::HashSet(std::size_t capacity, const Hash& hash, const Allocator& alloc) : _Items(hash, alloc)
+    {
+        _Items.Reserve(capacity);
+    }
+
+    template <class T, class Hash, class Allocator>
+    HashSet<T, Hash, Allocator>::HashSet(const HashSet& other, const Allocator& alloc) : _Items(other._Items, alloc) {}
+
+    template <class T, class Hash, class Allocator>
+    HashSet<T, Hash, Allocator>::HashSet(std::initializer_list<T> lst, const Allocator& alloc) : _Items(Hash(), alloc)
+    {
+        _Items.Reserve(lst.size());
+
+        for (const T& item : lst)
+            Add(item);
+    }
+
+    template <class T, class Hash, class Allocator>
+    template <ForwardIterableObjectOf<T> _It>
+    HashSet<T, Hash, Allocator>::HashSet(const _It& lst, const Allocator& alloc) : _Items(Hash(), alloc)
+    {
+        if constexpr (std::sized_sentinel_for<decltype(lst.end()), decltype(lst.begin())>)
+            _Items.Reserve(static_cast<std::size_t>(lst.end() - lst.begin()));
+
+        for (const T& item : lst)
+            Add(item);
+    }
+
+    // HashSet<T, Hash, Allocator> - Non-Template Member Functions
+
+    template <class T, class Hash, class Allocator>
+    bool HashSet<T, Hash, Allocator>::Add(const T& what)
+    {
+        return _Items.TryEmplace(what, what).second;
+    }
+
+    template <class T, class Hash, class Allocator>
+    bool HashSet<T, Hash, Allocator>::Add(T&& what)
+    {
+        // The item is only moved from once the lookup is done, when the slot gets constructed
+        return _Items.TryEmplace(what, std::move(what)).second;
+    }
+
+    template <class T, class Hash, class Allocator>
+    std::size_t HashSet<T, Hash, Allocator>::Capacity() const noexcept
+    {
+        return _Items.Capacity();
+    }
+
+    template <class T, class Hash, class Allocator>
+    void HashSet<T, Hash, Allocator>::Clear() noexcept
+    {
+        _Items.Clear();
+    }
+
+    template <class T, class Hash, class Allocator>
+    bool HashSet<T, Hash, Allocator>::Contains(const T& what) const
+    {
+        return (_Items.Find(what) != nullptr);
+    }
+
+    template <class T, class Hash, class Allocator>
+    std::size_t HashSet<T, Hash, Allocator>::Count() const noexcept
+    {
+        return _Items.Count();
+    }
+
+    template <class T, class Hash, class Allocator>
+    Allocator HashSet<T, Hash, Allocator>::GetAllocator() const noexcept
+    {
+        return _Items.GetAllocator();
+    }
+
+    template <class T, class Hash, class Allocator>
+    bool HashSet<T, Hash, Allocator>::Remove(const T& what)
+    {
+        return _Items.Remove(what);
+    }
+
+    template <class T, class Hash, class Allocator>
+    void HashSet<T, Hash, Allocator>::Reserve(std::size_t count)
+    {
+        _Items.Reserve(count);
+    }
+
+    template <class T, class Hash, class Allocator>
+    void HashSet<T, Hash, Allocator>::Swap(HashSet& other) noexcept
+    {
+        _Items.Swap(other._Items);
+    }
+
+    // HashSet<T, Hash, Allocator> - Template Member Functions
+
+    template <class T, class Hash, class Allocator>
+    template <class Q> requires TransparentHash<Hash>
+    bool HashSet<T, Hash, Allocator>::Contains(const Q& what) const
+    {
+        return (_Items.Find(what) != nullptr);
+    }
+
+    template <class T, class Hash, class Allocator>
+    template <class Q> requires TransparentHash<Hash>
+    bool HashSet<T, Hash, Allocator>::Remove(const Q& what)
+    {
+        return _Items.Remove(what);
+    }
+
+    // HashSet<T, Hash, Allocator> - Iterators
+
+    template <class T, class Hash, class Allocator>
+    typename HashSet<T, Hash, Allocator>::iterator HashSet<T, Hash, Allocator>::begin() const noexcept
+    {
+        return _Items.begin();
+    }
+
+    template <class T, class Hash, class Allocator>
+    typename HashSet<T, Hash, Allocator>::iterator HashSet<T, Hash, Allocator>::end() const noexcept
+    {
+        return _Items.end();
+    }
+#endif
+};
\ No newline at end of file
@@ -0,0 +1,682 @@
+#pragma once
+
+#include "Containers.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CQUE_HASH_SSE2
+#include <emmintrin.h>
+#endif
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief Hash used by Dictionary and HashSet unless told otherwise: std::hash, except that strings are hashed as string views
+    /// so that they can be looked up by string views and C strings without building a string first.
+    template <class T>
+    struct DefaultHash : std::hash<T> {};
+
+    template <class CharT, class Traits, class Alloc>
+    struct DefaultHash<std::basic_string<CharT, Traits, Alloc>>
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::basic_string_view<CharT, Traits> what) const noexcept
+        {
+            return std::hash<std::basic_string_view<CharT, Traits>>{}(what);
+        }
+    };
+
+    /// @brief Hashes accepting other types than the key, which allows looking keys up by those types, e.g. std::string keys by
+    /// std::string_view.
+    template <class THash>
+    concept TransparentHash = requires { typename THash::is_transparent; };
+
+    // Swiss table after Abseil's flat_hash_map. Each slot has a control byte which is either Empty, Deleted, or, for a full
+    // slot, the low 7 bits of its key's hash. A lookup compares the control bytes of a whole group of slots with those 7 bits
+    // at once and only compares the keys of the slots that match, which for a good hash is almost always just the right one.
+    // Groups start at any slot; the first _HashGroup::Width - 1 control bytes are mirrored past the end so that they wrap.
+
+    struct _HashGroup;
+
+    template <class T>
+    class _HashTableIterator;
+
+    /// @brief Open-addressing table shared by Dictionary and HashSet. _KeyOf::Get tells the key of an item.
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    class _HashTable
+    {
+    public:
+        using iterator = _HashTableIterator<T>;
+
+        // Constructors
+
+        explicit _HashTable(const Hash& hash = Hash(), const Allocator& alloc = Allocator()) noexcept(std::is_nothrow_copy_constructible_v<Hash>);
+        _HashTable(const _HashTable& other);
+        _HashTable(const _HashTable& other, const Allocator& alloc);
+        _HashTable(_HashTable&& other) noexcept;
+
+        // Member Functions
+
+        std::size_t Capacity() const noexcept;
+        void Clear() noexcept;
+        std::size_t Count() const noexcept;
+        Allocator GetAllocator() const noexcept;
+        void Reserve(std::size_t count);
+        void Swap(_HashTable& other) noexcept;
+
+        template <class Q>
+        T* Find(const Q& key) const;
+
+        template <class Q>
+        bool Remove(const Q& key);
+
+        /// @brief Constructs an item from the arguments unless an item with the given key is there already. Returns the item
+        /// with the key and whether it was just added.
+        template <class Q, class... Args>
+        std::pair<T*, bool> TryEmplace(const Q& key, Args&&... args);
+
+        /// @brief As TryEmplace, but the item is the result of calling the factory, which is only called once the key is known
+        /// to be missing. The result initializes the slot directly, without any conversion or move in between.
+        template <class Q, std::invocable _Factory> requires std::same_as<std::invoke_result_t<_Factory&>, T>
+        std::pair<T*, bool> TryEmplaceWith(const Q& key, _Factory&& factory);
+
+        // Iterators
+
+        iterator begin() const noexcept;
+        iterator end() const noexcept;
+
+        // Operators
+
+        _HashTable& operator=(const _HashTable& other);
+        _HashTable& operator=(_HashTable&& other) noexcept(std::allocator_traits<Allocator>::is_always_equal::value || std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value);
+
+        // Destructor
+
+        ~_HashTable();
+
+    private:
+        using _AllocTraits = std::allocator_traits<Allocator>;
+        using _ControlAllocator = typename _AllocTraits::template rebind_alloc<std::int8_t>;
+        using _ControlTraits = std::allocator_traits<_ControlAllocator>;
+
+        static constexpr std::int8_t _Empty = -128;
+        static constexpr std::int8_t _Deleted = -2;
+        static constexpr std::size_t _MinimumCapacity = 16;
+
+        // Up to 7/8 of the slots are used before the table grows
+        static constexpr std::size_t _MaxLoad(std::size_t capacity) noexcept;
+
+        static std::size_t _Mix(std::size_t hash) noexcept;
+
+        template <class Q>
+        std::size_t _HashOf(const Q& key) const;
+
+        template <class Q>
+        T* _Find(const Q& key, std::size_t hash) const;
+
+        std::size_t _FindFree(std::size_t hash) const noexcept;
+        void _Allocate(std::size_t capacity);
+        void _CopyFrom(const _HashTable& other);
+        void _Grow();
+        void _Rehash(std::size_t capacity);
+        void _Release() noexcept;
+        void _SetControl(std::size_t index, std::int8_t control) noexcept;
+        void _Steal(_HashTable& other) noexcept;
+
+        CQUE_NO_UNIQUE_ADDRESS Allocator _Alloc;
+        CQUE_NO_UNIQUE_ADDRESS Hash _Hash;
+
+        std::int8_t* _Control;
+        T* _Slots;
+        std::size_t _Capacity;
+        std::size_t _Count;
+        std::size_t _GrowthLeft;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ******************************************** _HashGroup ********************************************
+
+    // Masks have one bit per slot of the group, the lowest for the first slot
+#if defined(CQUE_HASH_SSE2)
+    struct _HashGroup
+    {
+        static constexpr std::size_t Width = 16;
+
+        explicit _HashGroup(const std::int8_t* where) noexcept : Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(where))) {}
+
+        std::uint32_t Match(std::int8_t control) const noexcept
+        {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(control), Control)));
+        }
+
+        // Empty and Deleted are the only control bytes with the sign bit set
+        std::uint32_t MatchFree() const noexcept
+        {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(Control));
+        }
+
+        __m128i Control;
+    };
+#else
+    struct _HashGroup
+    {
+        static constexpr std::size_t Width = 8;
+
+        explicit _HashGroup(const std::int8_t* where) noexcept
+        {
+            std::memcpy(Control, where, Width);
+        }
+
+        std::uint32_t Match(std::int8_t control) const noexcept
+        {
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < Width; i++)
+                mask |= static_cast<std::uint32_t>(Control[i] == control) << i;
+
+            return mask;
+        }
+
+        std::uint32_t MatchFree() const noexcept
+        {
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < Width; i++)
+                mask |= static_cast<std::uint32_t>(Control[i] < 0) << i;
+
+            return mask;
+        }
+
+        std::int8_t Control[Width];
+    };
+#endif
+
+    // ************************************** _HashTableIterator<T> ***************************************
+
+    template <class T>
+    class _HashTableIterator
+    {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        _HashTableIterator() noexcept = default;
+
+        _HashTableIterator(const std::int8_t* control, const std::int8_t* last, const T* slot) noexcept : _Control(control), _Last(last), _Slot(slot)
+        {
+            _SkipFree();
+        }
+
+        const T& operator*() const noexcept { return *_Slot; }
+        const T* operator->() const noexcept { return _Slot; }
+
+        _HashTableIterator& operator++() noexcept
+        {
+            ++_Control;
+            ++_Slot;
+            _SkipFree();
+
+            return *this;
+        }
+
+        _HashTableIterator operator++(int) noexcept
+        {
+            _HashTableIterator previous = *this;
+            ++*this;
+
+            return previous;
+        }
+
+        bool operator==(const _HashTableIterator& other) const noexcept { return (_Control == other._Control); }
+
+    private:
+        void _SkipFree() noexcept
+        {
+            while (_Control != _Last && *_Control < 0)
+            {
+                ++_Control;
+                ++_Slot;
+            }
+        }
+
+        const std::int8_t* _Control = nullptr;
+        const std::int8_t* _Last = nullptr;
+        const T* _Slot = nullptr;
+    };
+
+    // *************************** _HashTable<T, TKey, _KeyOf, Hash, Allocator> ***************************
+
+#if 1
+    // _HashTable<T, TKey, _KeyOf, Hash, Allocator> - Constructors
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_HashTable(const Hash& hash, const Allocator& alloc) noexcept(std::is_nothrow_copy_constructible_v<Hash>) : _Alloc(alloc), _Hash(hash),
+        _Control(nullptr), _Slots(nullptr), _Capacity(0), _Count(0), _GrowthLeft(0) {}
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_HashTable(const _HashTable& other) : _HashTable(other, _AllocTraits::select_on_container_copy_construction(other._Alloc)) {}
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_HashTable(const _HashTable& other, const Allocator& alloc) : _HashTable(other._Hash, alloc)
+    {
+        _CopyFrom(other);
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_HashTable(_HashTable&& other) noexcept : _Alloc(std::move(other._Alloc)), _Hash(other._Hash),
+        _Control(std::exchange(other._Control, nullptr)), _Slots(std::exchange(other._Slots, nullptr)), _Capacity(std::exchange(other._Capacity, 0)),
+        _Count(std::exchange(other._Count, 0)), _GrowthLeft(std::exchange(other._GrowthLeft, 0)) {}
+
+    // _HashTable<T, TKey, _KeyOf, Hash, Allocator> - Member Functions
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    std::size_t _HashTable<T, TKey, _KeyOf, Hash, Allocator>::Capacity() const noexcept
+    {
+        return _Capacity;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::Clear() noexcept
+    {
+        if (_Capacity == 0)
+            return;
+
+        for (std::size_t i = 0; i < _Capacity; i++)
+            if (_Control[i] >= 0)
+                std::destroy_at(&_Slots[i]);
+
+        std::memset(_Control, static_cast<unsigned char>(_Empty), _Capacity + _HashGroup::Width - 1);
+        _Count = 0;
+        _GrowthLeft = _MaxLoad(_Capacity);
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    std::size_t _HashTable<T, TKey, _KeyOf, Hash, Allocator>::Count() const noexcept
+    {
+        return _Count;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    Allocator _HashTable<T, TKey, _KeyOf, Hash, Allocator>::GetAllocator() const noexcept
+    {
+        return _Alloc;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::Reserve(std::size_t count)
+    {
+        std::size_t capacity = _MinimumCapacity;
+        while (_MaxLoad(capacity) < count)
+            capacity *= 2;
+
+        if (capacity > _Capacity)
+            _Rehash(capacity);
+    }
+
+    /// @brief Exchanges the contents of two tables. Unless the allocator propagates on swap, both tables must use equal allocators.
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::Swap(_HashTable& other) noexcept
+    {
+        using std::swap;
+
+        if constexpr (_AllocTraits::propagate_on_container_swap::value)
+            swap(_Alloc, other._Alloc);
+
+        swap(_Hash, other._Hash);
+        swap(_Control, other._Control);
+        swap(_Slots, other._Slots);
+        swap(_Capacity, other._Capacity);
+        swap(_Count, other._Count);
+        swap(_GrowthLeft, other._GrowthLeft);
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    template <class Q>
+    T* _HashTable<T, TKey, _KeyOf, Hash, Allocator>::Find(const Q& key) const
+    {
+        return (_Count != 0) ? _Find(key, _HashOf(key)) : nullptr;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    template <class Q>
+    bool _HashTable<T, TKey, _KeyOf, Hash, Allocator>::Remove(const Q& key)
+    {
+        T* slot = Find(key);
+        if (!slot)
+            return false;
+
+        // The slot becomes a tombstone, so that lookups probing past it still go on; tombstones are cleared by rehashing
+        std::destroy_at(slot);
+        _SetControl(static_cast<std::size_t>(slot - _Slots), _Deleted);
+        _Count--;
+
+        return true;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    template <class Q, class... Args>
+    std::pair<T*, bool> _HashTable<T, TKey, _KeyOf, Hash, Allocator>::TryEmplace(const Q& key, Args&&... args)
+    {
+        return TryEmplaceWith(key, [&]() { return T(std::forward<Args>(args)...); });
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    template <class Q, std::invocable _Factory> requires std::same_as<std::invoke_result_t<_Factory&>, T>
+    std::pair<T*, bool> _HashTable<T, TKey, _KeyOf, Hash, Allocator>::TryEmplaceWith(const Q& key, _Factory&& factory)
+    {
+        std::size_t hash = _HashOf(key);
+
+        if (_Count != 0)
+            if (T* found = _Find(key, hash))
+                return { found, false };
+
+        std::size_t index;
+        if (_GrowthLeft == 0)
+        {
+            // The factory may well refer to items of this table, which growing moves, hence the item is made beforehand
+            T item(std::invoke(factory));
+
+            _Grow();
+            index = _FindFree(hash);
+            std::construct_at(&_Slots[index], std::move(item));
+        }
+        else
+        {
+            // Placement new, unlike std::construct_at, lets the returned prvalue initialize the slot itself
+            index = _FindFree(hash);
+            ::new (static_cast<void*>(&_Slots[index])) T(std::invoke(factory));
+        }
+
+        // Reusing a tombstone leaves the number of slots never used unchanged
+        if (_Control[index] == _Empty)
+            _GrowthLeft--;
+
+        _SetControl(index, static_cast<std::int8_t>(hash & 0x7F));
+        _Count++;
+
+        return { &_Slots[index], true };
+    }
+
+    // _HashTable<T, TKey, _KeyOf, Hash, Allocator> - Iterators
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTableIterator<T> _HashTable<T, TKey, _KeyOf, Hash, Allocator>::begin() const noexcept
+    {
+        return _HashTableIterator<T>(_Control, _Control + _Capacity, _Slots);
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTableIterator<T> _HashTable<T, TKey, _KeyOf, Hash, Allocator>::end() const noexcept
+    {
+        return _HashTableIterator<T>(_Control + _Capacity, _Control + _Capacity, _Slots + _Capacity);
+    }
+
+    // _HashTable<T, TKey, _KeyOf, Hash, Allocator> - Operators
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTable<T, TKey, _KeyOf, Hash, Allocator>& _HashTable<T, TKey, _KeyOf, Hash, Allocator>::operator=(const _HashTable& other)
+    {
+        if (this == &other)
+            return *this;
+
+        _Release();
+
+        if constexpr (_AllocTraits::propagate_on_container_copy_assignment::value)
+            _Alloc = other._Alloc;
+
+        _Hash = other._Hash;
+        _CopyFrom(other);
+
+        return *this;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTable<T, TKey, _KeyOf, Hash, Allocator>& _HashTable<T, TKey, _KeyOf, Hash, Allocator>::operator=(_HashTable&& other) noexcept(std::allocator_traits<Allocator>::is_always_equal::value || std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
+    {
+        if (this == &other)
+            return *this;
+
+        _Release();
+        _Hash = other._Hash;
+
+        if (_AllocTraits::propagate_on_container_move_assignment::value || _AllocTraits::is_always_equal::value || _Alloc == other._Alloc)
+        {
+            if constexpr (_AllocTraits::propagate_on_container_move_assignment::value)
+                _Alloc = std::move(other._Alloc);
+
+            _Steal(other);
+        }
+        else
+        {
+            // The other table's memory cannot be adopted by an unequal allocator, so the items are moved over one by one
+            Reserve(other._Count);
+
+            for (const T& item : other)
+                TryEmplace(_KeyOf::Get(item), std::move(const_cast<T&>(item)));
+
+            other.Clear();
+        }
+
+        return *this;
+    }
+
+    // _HashTable<T, TKey, _KeyOf, Hash, Allocator> - Destructor
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    _HashTable<T, TKey, _KeyOf, Hash, Allocator>::~_HashTable()
+    {
+        _Release();
+    }
+
+    // _HashTable<T, TKey, _KeyOf, Hash, Allocator> - Private Member Functions
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    constexpr std::size_t _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_MaxLoad(std::size_t capacity) noexcept
+    {
+        return capacity - capacity / 8;
+    }
+
+    /// @brief Spreads the bits of the hash all over, as std::hash is the identity for integers on the common standard libraries,
+    /// which would leave the 7 bits kept in the control bytes the same for every key of a multiple of 128.
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    std::size_t _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_Mix(std::size_t hash) noexcept
+    {
+        std::uint64_t mixed = hash;
+        mixed ^= mixed >> 33;
+        mixed *= 0xff51afd7ed558ccdull;
+        mixed ^= mixed >> 33;
+
+        return static_cast<std::size_t>(mixed);
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    template <class Q>
+    std::size_t _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_HashOf(const Q& key) const
+    {
+        return _Mix(static_cast<std::size_t>(std::invoke(_Hash, key)));
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    template <class Q>
+    T* _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_Find(const Q& key, std::size_t hash) const
+    {
+        const std::int8_t control = static_cast<std::int8_t>(hash & 0x7F);
+        const std::size_t mask = _Capacity - 1;
+
+        // Triangular probing visits every group before coming back, and there is always an empty slot to stop at
+        std::size_t position = (hash >> 7) & mask;
+        for (std::size_t step = _HashGroup::Width;; step += _HashGroup::Width)
+        {
+            _HashGroup group(&_Control[position]);
+
+            for (std::uint32_t match = group.Match(control); match != 0; match &= match - 1)
+            {
+                std::size_t index = (position + static_cast<std::size_t>(std::countr_zero(match))) & mask;
+                if (_KeyOf::Get(_Slots[index]) == key)
+                    return &_Slots[index];
+            }
+
+            if (group.Match(_Empty) != 0)
+                return nullptr;
+
+            position = (position + step) & mask;
+        }
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    std::size_t _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_FindFree(std::size_t hash) const noexcept
+    {
+        const std::size_t mask = _Capacity - 1;
+
+        std::size_t position = (hash >> 7) & mask;
+        for (std::size_t step = _HashGroup::Width;; step += _HashGroup::Width)
+        {
+            if (std::uint32_t free = _HashGroup(&_Control[position]).MatchFree(); free != 0)
+                return (position + static_cast<std::size_t>(std::countr_zero(free))) & mask;
+
+            position = (position + step) & mask;
+        }
+    }
+
+    /// @brief Replaces the storage with an empty one of the given capacity, a power of 2 of at least _MinimumCapacity. The
+    /// previous storage is left to the caller.
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_Allocate(std::size_t capacity)
+    {
+        _ControlAllocator control_alloc(_Alloc);
+        std::int8_t* control = _ControlTraits::allocate(control_alloc, capacity + _HashGroup::Width - 1);
+
+        try
+        {
+            _Slots = _AllocTraits::allocate(_Alloc, capacity);
+        }
+        catch (...)
+        {
+            _ControlTraits::deallocate(control_alloc, control, capacity + _HashGroup::Width - 1);
+            throw;
+        }
+
+        std::memset(control, static_cast<unsigned char>(_Empty), capacity + _HashGroup::Width - 1);
+
+        _Control = control;
+        _Capacity = capacity;
+        _GrowthLeft = _MaxLoad(capacity) - _Count;
+    }
+
+    /// @brief Copies the other table's slots as they are, tombstones included, into this empty table.
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_CopyFrom(const _HashTable& other)
+    {
+        if (other._Count == 0)
+            return;
+
+        _Allocate(other._Capacity);
+
+        std::size_t i = 0;
+        try
+        {
+            for (; i < _Capacity; i++)
+                if (other._Control[i] >= 0)
+                    std::construct_at(&_Slots[i], other._Slots[i]);
+        }
+        catch (...)
+        {
+            while (i-- > 0)
+                if (other._Control[i] >= 0)
+                    std::destroy_at(&_Slots[i]);
+
+            std::memset(_Control, static_cast<unsigned char>(_Empty), _Capacity + _HashGroup::Width - 1);
+            throw;
+        }
+
+        std::memcpy(_Control, other._Control, _Capacity + _HashGroup::Width - 1);
+        _Count = other._Count;
+        _GrowthLeft = other._GrowthLeft;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_Grow()
+    {
+        // A table mostly filled with tombstones is cleaned up in place rather than grown
+        if (_Capacity == 0)
+            _Rehash(_MinimumCapacity);
+        else if (_Count < _MaxLoad(_Capacity) / 2)
+            _Rehash(_Capacity);
+        else
+            _Rehash(_Capacity * 2);
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_Rehash(std::size_t capacity)
+    {
+        std::int8_t* old_control = _Control;
+        T* old_slots = _Slots;
+        std::size_t old_capacity = _Capacity;
+
+        _Allocate(capacity);
+
+        for (std::size_t i = 0; i < old_capacity; i++)
+        {
+            if (old_control[i] < 0)
+                continue;
+
+            std::size_t hash = _HashOf(_KeyOf::Get(old_slots[i]));
+            std::size_t index = _FindFree(hash);
+
+            std::construct_at(&_Slots[index], std::move(old_slots[i]));
+            std::destroy_at(&old_slots[i]);
+            _SetControl(index, static_cast<std::int8_t>(hash & 0x7F));
+        }
+
+        if (old_capacity != 0)
+        {
+            _ControlAllocator control_alloc(_Alloc);
+            _ControlTraits::deallocate(control_alloc, old_control, old_capacity + _HashGroup::Width - 1);
+            _AllocTraits::deallocate(_Alloc, old_slots, old_capacity);
+        }
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_Release() noexcept
+    {
+        if (_Capacity == 0)
+            return;
+
+        Clear();
+
+        _ControlAllocator control_alloc(_Alloc);
+        _ControlTraits::deallocate(control_alloc, _Control, _Capacity + _HashGroup::Width - 1);
+        _AllocTraits::deallocate(_Alloc, _Slots, _Capacity);
+
+        _Control = nullptr;
+        _Slots = nullptr;
+        _Capacity = _GrowthLeft = 0;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_SetControl(std::size_t index, std::int8_t control) noexcept
+    {
+        _Control[index] = control;
+
+        if (index < _HashGroup::Width - 1)
+            _Control[_Capacity + index] = control;
+    }
+
+    template <class T, class TKey, class _KeyOf, class Hash, class Allocator>
+    void _HashTable<T, TKey, _KeyOf, Hash, Allocator>::_Steal(_HashTable& other) noexcept
+    {
+        _Control = std::exchange(other._Control, nullptr);
+        _Slots = std::exchange(other._Slots, nullptr);
+        _Capacity = std::exchange(other._Capacity, 0);
+        _Count = std::exchange(other._Count, 0);
+        _GrowthLeft = std::exchange(other._GrowthLeft, 0);
+    }
+#endif
+};
\ No newline at end of file
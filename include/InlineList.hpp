@@ -0,0 +1,1333 @@
+#pragma once
+
+#include "Containers.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief A List which keeps its first N items inside the object itself and only turns to the allocator once it grows past
+    /// N, so that short lists never allocate. Offers the same members as List<T, Allocator, Growth>. Moving a list whose items
+    /// are held inline moves the items one by one rather than handing over a pointer. During constant evaluation the inline
+    /// storage is not used and the list behaves like a List.
+    /// @tparam T Type of the items
+    /// @tparam N Number of items held inline
+    /// @tparam Growth How much room to make whenever the list runs out of it, inline or not
+    template <class T, std::size_t N, class Allocator = std::allocator<T>, GrowthPolicy Growth = DoublingGrowth>
+    class InlineList
+    {
+        static_assert(N > 0, "InlineList needs room for at least one inline item; use List otherwise");
+
+    public:
+        // Constructors
+
+        constexpr InlineList() noexcept(std::is_nothrow_default_constructible_v<Allocator>);
+        constexpr explicit InlineList(const Allocator& alloc) noexcept;
+        constexpr InlineList(const InlineList<T, N, Allocator, Growth>& other);
+        constexpr InlineList(const InlineList<T, N, Allocator, Growth>& other, const Allocator& alloc);
+        constexpr InlineList(InlineList<T, N, Allocator, Growth>&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+        constexpr InlineList(InlineList<T, N, Allocator, Growth>&& other, const Allocator& alloc);
+
+        constexpr InlineList(std::size_t initial_size, const Allocator& alloc = Allocator()) requires std::default_initializable<T>;
+        constexpr InlineList(std::initializer_list<T> lst, const Allocator& alloc = Allocator());
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr InlineList(const _It& lst, const Allocator& alloc = Allocator());
+
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+        constexpr InlineList(_It&& lst, const Allocator& alloc = Allocator());
+
+        template <std::forward_iterator _It>
+        constexpr InlineList(_It first, _It last, const Allocator& alloc = Allocator());
+
+        // Non-Template Member Functions
+
+        constexpr void Add(const T& what);
+        constexpr void Add(T&& what);
+
+        /// @brief Item at the index, throwing std::out_of_range past the end, as operator[] does.
+        constexpr T& At(std::size_t index);
+        constexpr const T& At(std::size_t index) const;
+
+        /// @brief Searches the list, sorted in ascending order, for the item. Returns its index or, if it is not there, the bitwise
+        /// complement of the index at which it would be inserted; see Container::BinarySearch.
+        constexpr std::size_t BinarySearch(const T& what) const;
+
+        constexpr std::size_t Capacity() const noexcept;
+        constexpr void Clear() noexcept(std::is_nothrow_destructible_v<T>);
+        constexpr bool Contains(const T& what) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>;
+        constexpr std::size_t Count() const noexcept;
+
+        /// @brief Pointer to the first of Count() contiguous items; may be null while there are none.
+        constexpr T* Data() noexcept;
+        constexpr const T* Data() const noexcept;
+
+        constexpr bool Exists(Predicate<const T&> match) const;
+        constexpr T Find(Predicate<const T&> match) const;
+        constexpr InlineList<T, N, Allocator, Growth> FindAll(Predicate<const T&> match) const;
+        constexpr std::size_t FindIndex(Predicate<const T&> match) const;
+        constexpr T FindLast(Predicate<const T&> match) const;
+        constexpr std::size_t FindLastIndex(Predicate<const T&> match) const;
+        constexpr Allocator GetAllocator() const noexcept;
+        constexpr std::size_t IndexOf(const T& what) const noexcept;
+        constexpr void Insert(std::size_t index, const T& what);
+        constexpr void Insert(std::size_t index, T&& what);
+
+        /// @brief Inserts the item into the list, sorted in ascending order, after the items equivalent to it and returns its index.
+        constexpr std::size_t InsertSorted(const T& what);
+        constexpr std::size_t InsertSorted(T&& what);
+
+        /// @brief Whether the items are currently held inside the object rather than in allocated memory.
+        constexpr bool IsInline() const noexcept;
+
+        constexpr std::size_t LastIndexOf(const T& what) const noexcept;
+        constexpr std::size_t LowerBound(const T& what) const;
+        constexpr bool Remove(const T& what) noexcept;
+        constexpr std::size_t RemoveAll(Predicate<const T&> match);
+        constexpr void RemoveAt(std::size_t index);
+        constexpr void RemoveRange(std::size_t index, std::size_t count);
+
+        /// @brief Makes room for at least the given number of items, allocating exactly that many if there is not enough.
+        constexpr void Reserve(std::size_t capacity);
+
+        constexpr void Resize(std::size_t n) requires std::default_initializable<T>;
+        constexpr void Reverse() noexcept(std::is_nothrow_swappable_v<T>);
+
+        /// @brief Moves the items back inline if they fit there, otherwise reallocates to exactly the number of items held.
+        constexpr void ShrinkToFit();
+
+        constexpr void Sort();
+        constexpr void Sort(Comparison<T> compare);
+        constexpr void Swap(InlineList<T, N, Allocator, Growth>& other) noexcept(std::is_nothrow_move_constructible_v<T>&& std::is_nothrow_swappable_v<T>);
+
+        /// @brief Item at the index with no bounds check, for loops which already keep the index within Count().
+        constexpr T& UnsafeAt(std::size_t index) noexcept;
+        constexpr const T& UnsafeAt(std::size_t index) const noexcept;
+        constexpr std::size_t UpperBound(const T& what) const;
+
+        // Template Member Functions
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr void AddRange(const _It& what);
+
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+        constexpr void AddRange(_It&& what);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t BinarySearch(const T& what, _Compare compare) const;
+
+        template <class TOutput>
+        constexpr InlineList<TOutput, N, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> ConvertAll(Converter<T, TOutput> converter = &DefaultConvert<T, TOutput>) const;
+
+        template <class TOutput, ConverterOf<T, TOutput> _Converter>
+        constexpr InlineList<TOutput, N, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> ConvertAll(_Converter converter) const;
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr void CopyTo(_It& where) const noexcept(std::is_nothrow_copy_assignable_v<T>);
+
+        /// @brief Constructs an item from the given arguments at the end of the list and returns it.
+        template <class... Args> requires std::constructible_from<T, Args...>
+        constexpr T& Emplace(Args&&... args);
+
+        /// @brief Constructs an item from the given arguments at the given index and returns it.
+        template <class... Args> requires std::constructible_from<T, Args...>
+        constexpr T& EmplaceAt(std::size_t index, Args&&... args);
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr bool Exists(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr T Find(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr InlineList<T, N, Allocator, Growth> FindAll(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t FindIndex(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr T FindLast(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t FindLastIndex(_Predicate match) const;
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr void InsertRange(std::size_t index, const _It& what);
+
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+        constexpr void InsertRange(std::size_t index, _It&& what);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t InsertSorted(const T& what, _Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t InsertSorted(T&& what, _Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t LowerBound(const T& what, _Compare compare) const;
+
+        /// @brief Merges the items of another sorted container into this sorted list in linear time, keeping it sorted. Of
+        /// equivalent items, those of this list come first.
+        template <ForwardIterableObjectOf<T> _It, std::strict_weak_order<const T&, const T&> _Compare = DefaultComparer<T>>
+        constexpr void MergeSorted(const _It& other, _Compare compare = _Compare());
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t RemoveAll(_Predicate match);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr void Sort(_Compare compare);
+
+        template <ThreeWayComparison<T> _Compare>
+        constexpr void Sort(_Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t UpperBound(const T& what, _Compare compare) const;
+
+        // Iterators
+
+        constexpr T* begin() const noexcept;
+        constexpr T* end() const noexcept;
+        constexpr const T* cbegin() const noexcept;
+        constexpr const T* cend() const noexcept;
+
+        // Operators
+
+        constexpr InlineList<T, N, Allocator, Growth>& operator=(const InlineList<T, N, Allocator, Growth>& other);
+        constexpr InlineList<T, N, Allocator, Growth>& operator=(InlineList<T, N, Allocator, Growth>&& other);
+
+        constexpr T& operator[](std::size_t index);
+        constexpr const T& operator[](std::size_t index) const;
+
+        constexpr bool operator==(const InlineList<T, N, Allocator, Growth>& other) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>;
+
+        // Destructor
+
+        constexpr ~InlineList() noexcept(std::is_nothrow_destructible_v<T>);
+
+    protected:
+        using _AllocTraits = std::allocator_traits<Allocator>;
+
+        constexpr T* _InlineElems() const noexcept;
+        constexpr void _ResetToInline() noexcept;
+
+        constexpr T* _Allocate(std::size_t n);
+        constexpr void _Deallocate(T* where, std::size_t n) noexcept;
+        constexpr std::size_t _NextCapacity(std::size_t min_capacity) const noexcept;
+        constexpr void _Reallocate(std::size_t new_capacity);
+        constexpr void _Reserve(std::size_t min_capacity);
+        constexpr void _Release() noexcept(std::is_nothrow_destructible_v<T>);
+        constexpr void _ShiftElements(std::size_t from, std::size_t to) noexcept;
+        constexpr void _StealOrMove(InlineList<T, N, Allocator, Growth>& other, bool can_steal);
+
+        template <class... Args>
+        constexpr void _EmplaceReallocating(std::size_t index, Args&&... args);
+
+        template <class U>
+        constexpr void _InsertOne(std::size_t index, U&& what);
+
+        static constexpr bool _IsBulkRelocatable() noexcept;
+
+        // Declared first so that it is ready by the time the other members allocate in the constructors' initializer lists
+        CQUE_NO_UNIQUE_ADDRESS Allocator _Alloc;
+
+        std::size_t _Capacity;
+        std::size_t _Count;
+        T* _Elems;
+
+        alignas(T) unsigned char _Inline[N * sizeof(T)];
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ******************************* InlineList<T, N, Allocator, Growth> ********************************
+
+    // InlineList<T, N, Allocator, Growth> - Constructors
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList() noexcept(std::is_nothrow_default_constructible_v<Allocator>) : _Alloc(), _Capacity(0), _Count(0), _Elems(nullptr)
+    {
+        _ResetToInline();
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(const Allocator& alloc) noexcept : _Alloc(alloc), _Capacity(0), _Count(0), _Elems(nullptr)
+    {
+        _ResetToInline();
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(const InlineList<T, N, Allocator, Growth>& other) : InlineList(other, _AllocTraits::select_on_container_copy_construction(other._Alloc)) {}
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(const InlineList<T, N, Allocator, Growth>& other, const Allocator& alloc) : InlineList(alloc)
+    {
+        AddRange(other);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(InlineList<T, N, Allocator, Growth>&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : InlineList(std::move(other._Alloc))
+    {
+        _StealOrMove(other, true);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(InlineList<T, N, Allocator, Growth>&& other, const Allocator& alloc) : InlineList(alloc)
+    {
+        _StealOrMove(other, _AllocTraits::is_always_equal::value || _Alloc == other._Alloc);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(std::size_t initial_size, const Allocator& alloc) requires std::default_initializable<T> : InlineList(alloc)
+    {
+        _Reserve(initial_size);
+        UninitializedDefaultConstruct(_Elems, initial_size);
+        _Count = initial_size;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(std::initializer_list<T> lst, const Allocator& alloc) : InlineList(alloc)
+    {
+        _Reserve(lst.size());
+        UninitializedCopy(lst.begin(), lst.end(), _Elems);
+        _Count = lst.size();
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(const _It& lst, const Allocator& alloc) : InlineList(alloc)
+    {
+        AddRange(lst);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(_It&& lst, const Allocator& alloc) : InlineList(alloc)
+    {
+        AddRange(std::move(lst));
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::forward_iterator _It>
+    constexpr InlineList<T, N, Allocator, Growth>::InlineList(_It first, _It last, const Allocator& alloc) : InlineList(alloc)
+    {
+        std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+
+        _Reserve(count);
+        UninitializedCopy(first, last, _Elems);
+        _Count = count;
+    }
+
+    // InlineList<T, N, Allocator, Growth> - Non-Template Member Functions
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Add(const T& what)
+    {
+        _InsertOne(_Count, what);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Add(T&& what)
+    {
+        _InsertOne(_Count, std::move(what));
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T& InlineList<T, N, Allocator, Growth>::At(std::size_t index)
+    {
+        return (*this)[index];
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr const T& InlineList<T, N, Allocator, Growth>::At(std::size_t index) const
+    {
+        return (*this)[index];
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::BinarySearch(const T& what) const
+    {
+        return BinarySearch<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::Capacity() const noexcept
+    {
+        return _Capacity;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Clear() noexcept(std::is_nothrow_destructible_v<T>)
+    {
+        std::destroy_n(_Elems, _Count);
+        _Count = 0;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr bool InlineList<T, N, Allocator, Growth>::Contains(const T& what) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>
+    {
+        return (IndexOf(what) != (std::size_t)(-1));
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::Count() const noexcept
+    {
+        return _Count;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T* InlineList<T, N, Allocator, Growth>::Data() noexcept
+    {
+        return _Elems;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr const T* InlineList<T, N, Allocator, Growth>::Data() const noexcept
+    {
+        return _Elems;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr bool InlineList<T, N, Allocator, Growth>::Exists(Predicate<const T&> match) const
+    {
+        return Exists<Predicate<const T&>>(match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T InlineList<T, N, Allocator, Growth>::Find(Predicate<const T&> match) const
+    {
+        return Find<Predicate<const T&>>(match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth> InlineList<T, N, Allocator, Growth>::FindAll(Predicate<const T&> match) const
+    {
+        return FindAll<Predicate<const T&>>(match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::FindIndex(Predicate<const T&> match) const
+    {
+        return FindIndex<Predicate<const T&>>(match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T InlineList<T, N, Allocator, Growth>::FindLast(Predicate<const T&> match) const
+    {
+        return FindLast<Predicate<const T&>>(match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::FindLastIndex(Predicate<const T&> match) const
+    {
+        return FindLastIndex<Predicate<const T&>>(match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr Allocator InlineList<T, N, Allocator, Growth>::GetAllocator() const noexcept
+    {
+        return _Alloc;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::IndexOf(const T& what) const noexcept
+    {
+        return Container::IndexOf<T>(*this, what);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Insert(std::size_t index, const T& what)
+    {
+        _InsertOne(index, what);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Insert(std::size_t index, T&& what)
+    {
+        _InsertOne(index, std::move(what));
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::InsertSorted(const T& what)
+    {
+        return InsertSorted<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::InsertSorted(T&& what)
+    {
+        return InsertSorted<DefaultComparer<T>>(std::move(what), DefaultComparer<T>{});
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr bool InlineList<T, N, Allocator, Growth>::IsInline() const noexcept
+    {
+        return (_Elems && _Elems == _InlineElems());
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::LastIndexOf(const T& what) const noexcept
+    {
+        return Container::LastIndexOf<T>(*this, what);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::LowerBound(const T& what) const
+    {
+        return LowerBound<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr bool InlineList<T, N, Allocator, Growth>::Remove(const T& what) noexcept
+    {
+        try
+        {
+            std::size_t pos = IndexOf(what);
+            if (pos != (std::size_t)(-1))
+            {
+                RemoveAt(pos);
+                return true;
+            }
+            else
+                return false;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::RemoveAll(Predicate<const T&> match)
+    {
+        return RemoveAll<Predicate<const T&>>(match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::RemoveAt(std::size_t index)
+    {
+        RemoveRange(index, 1);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::RemoveRange(std::size_t index, std::size_t count)
+    {
+        if (index <= _Count && count <= _Count - index)
+        {
+            if (count == 0)
+                return;
+
+            if (_IsBulkRelocatable())
+            {
+                std::destroy_n(&_Elems[index], count);
+                _ShiftElements(index + count, index);
+            }
+            else
+            {
+                std::move(&_Elems[index + count], &_Elems[_Count], &_Elems[index]);
+                std::destroy_n(&_Elems[_Count - count], count);
+            }
+
+            _Count -= count;
+        }
+        else
+            throw std::out_of_range("where");
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Reserve(std::size_t capacity)
+    {
+        if (capacity > _Capacity)
+            _Reallocate(capacity);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Resize(std::size_t n) requires std::default_initializable<T>
+    {
+        if (n < _Count)
+            std::destroy(&_Elems[n], &_Elems[_Count]);
+        else if (n > _Count)
+        {
+            _Reserve(n);
+            UninitializedDefaultConstruct(&_Elems[_Count], n - _Count);
+        }
+
+        _Count = n;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Reverse() noexcept(std::is_nothrow_swappable_v<T>)
+    {
+        std::reverse(_Elems, _Elems + _Count);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::ShrinkToFit()
+    {
+        if (IsInline() || _Capacity == _Count)
+            return;
+
+        T* inline_elems = _InlineElems();
+        if (inline_elems && _Count <= N)
+        {
+            UninitializedRelocate(_Elems, _Elems + _Count, inline_elems);
+            _Deallocate(_Elems, _Capacity);
+
+            _Elems = inline_elems;
+            _Capacity = N;
+        }
+        else if (_Count == 0)
+        {
+            _Deallocate(_Elems, _Capacity);
+            _ResetToInline();
+        }
+        else
+            _Reallocate(_Count);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Sort()
+    {
+        Sort<DefaultComparer<T>>(DefaultComparer<T>{});
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Sort(Comparison<T> compare)
+    {
+        Sort<Comparison<T>>(compare);
+    }
+
+    /// @brief Exchanges the contents of two lists. Unless the allocator propagates on swap, both lists must use equal allocators.
+    /// Allocated memory changes hands, whereas items held inline are swapped or moved across.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::Swap(InlineList<T, N, Allocator, Growth>& other) noexcept(std::is_nothrow_move_constructible_v<T>&& std::is_nothrow_swappable_v<T>)
+    {
+        if (this == &other)
+            return;
+
+        if constexpr (_AllocTraits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(_Alloc, other._Alloc);
+        }
+
+        if (!IsInline() && !other.IsInline())
+        {
+            std::swap(_Capacity, other._Capacity);
+            std::swap(_Count, other._Count);
+            std::swap(_Elems, other._Elems);
+        }
+        else if (IsInline() && other.IsInline())
+        {
+            InlineList<T, N, Allocator, Growth>& shorter = (_Count <= other._Count) ? *this : other;
+            InlineList<T, N, Allocator, Growth>& longer = (_Count <= other._Count) ? other : *this;
+
+            std::swap_ranges(shorter._Elems, shorter._Elems + shorter._Count, longer._Elems);
+            UninitializedRelocate(longer._Elems + shorter._Count, longer._Elems + longer._Count, shorter._Elems + shorter._Count);
+            std::swap(_Count, other._Count);
+        }
+        else
+        {
+            // The list holding its items inline moves them over to the other one's inline storage and takes its memory instead
+            InlineList<T, N, Allocator, Growth>& held_inline = IsInline() ? *this : other;
+            InlineList<T, N, Allocator, Growth>& allocated = IsInline() ? other : *this;
+
+            T* elems = allocated._Elems;
+            std::size_t capacity = allocated._Capacity;
+            std::size_t count = allocated._Count;
+
+            allocated._ResetToInline();
+            UninitializedRelocate(held_inline._Elems, held_inline._Elems + held_inline._Count, allocated._Elems);
+            allocated._Count = held_inline._Count;
+
+            held_inline._Elems = elems;
+            held_inline._Capacity = capacity;
+            held_inline._Count = count;
+        }
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T& InlineList<T, N, Allocator, Growth>::UnsafeAt(std::size_t index) noexcept
+    {
+        return _Elems[index];
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr const T& InlineList<T, N, Allocator, Growth>::UnsafeAt(std::size_t index) const noexcept
+    {
+        return _Elems[index];
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::UpperBound(const T& what) const
+    {
+        return UpperBound<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    // InlineList<T, N, Allocator, Growth> - Template Member Functions
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr void InlineList<T, N, Allocator, Growth>::AddRange(const _It& what)
+    {
+        std::size_t add_count = static_cast<std::size_t>(std::distance(what.begin(), what.end()));
+
+        _Reserve(_Count + add_count);
+        UninitializedCopy(what.begin(), what.end(), &_Elems[_Count]);
+        _Count += add_count;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr void InlineList<T, N, Allocator, Growth>::AddRange(_It&& what)
+    {
+        std::size_t add_count = static_cast<std::size_t>(std::distance(what.begin(), what.end()));
+
+        _Reserve(_Count + add_count);
+        UninitializedMove(what.begin(), what.end(), &_Elems[_Count]);
+        _Count += add_count;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::BinarySearch(const T& what, _Compare compare) const
+    {
+        return Container::BinarySearch<T, InlineList<T, N, Allocator, Growth>, _Compare>(*this, what, compare);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <class TOutput>
+    constexpr InlineList<TOutput, N, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> InlineList<T, N, Allocator, Growth>::ConvertAll(Converter<T, TOutput> converter) const
+    {
+        return ConvertAll<TOutput, Converter<T, TOutput>>(converter);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <class TOutput, ConverterOf<T, TOutput> _Converter>
+    constexpr InlineList<TOutput, N, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> InlineList<T, N, Allocator, Growth>::ConvertAll(_Converter converter) const
+    {
+        using _OutputAllocator = typename _AllocTraits::template rebind_alloc<TOutput>;
+
+        InlineList<TOutput, N, _OutputAllocator, Growth> out(_OutputAllocator(_AllocTraits::select_on_container_copy_construction(_Alloc)));
+        for (std::size_t i = 0; i < _Count; i++)
+            out.Add(std::invoke(converter, _Elems[i]));
+
+        return out;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr void InlineList<T, N, Allocator, Growth>::CopyTo(_It& where) const noexcept(std::is_nothrow_copy_assignable_v<T>)
+    {
+        std::copy(_Elems, &_Elems[_Count], where.begin());
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <class... Args> requires std::constructible_from<T, Args...>
+    constexpr T& InlineList<T, N, Allocator, Growth>::Emplace(Args&&... args)
+    {
+        if (_Count == _Capacity)
+            _EmplaceReallocating(_Count, std::forward<Args>(args)...);
+        else
+            std::construct_at(&_Elems[_Count], std::forward<Args>(args)...);
+
+        return _Elems[_Count++];
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <class... Args> requires std::constructible_from<T, Args...>
+    constexpr T& InlineList<T, N, Allocator, Growth>::EmplaceAt(std::size_t index, Args&&... args)
+    {
+        if (index == _Count)
+            return Emplace(std::forward<Args>(args)...);
+        else if (index < _Count)
+        {
+            if (_Count == _Capacity)
+            {
+                _EmplaceReallocating(index, std::forward<Args>(args)...);
+                _Count++;
+            }
+            // Built aside first as the arguments may refer to the items about to be shifted
+            else
+                Insert(index, T(std::forward<Args>(args)...));
+
+            return _Elems[index];
+        }
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr bool InlineList<T, N, Allocator, Growth>::Exists(_Predicate match) const
+    {
+        return Container::Exists<T, InlineList<T, N, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr T InlineList<T, N, Allocator, Growth>::Find(_Predicate match) const
+    {
+        return Container::Find<T, InlineList<T, N, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr InlineList<T, N, Allocator, Growth> InlineList<T, N, Allocator, Growth>::FindAll(_Predicate match) const
+    {
+        InlineList<T, N, Allocator, Growth> out(_AllocTraits::select_on_container_copy_construction(_Alloc));
+        for (std::size_t i = 0; i < _Count; i++)
+            if (std::invoke(match, _Elems[i]))
+                out.Add(_Elems[i]);
+
+        return out;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::FindIndex(_Predicate match) const
+    {
+        return Container::FindIndex<T, InlineList<T, N, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr T InlineList<T, N, Allocator, Growth>::FindLast(_Predicate match) const
+    {
+        return Container::FindLast<T, InlineList<T, N, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::FindLastIndex(_Predicate match) const
+    {
+        return Container::FindLastIndex<T, InlineList<T, N, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr void InlineList<T, N, Allocator, Growth>::InsertRange(std::size_t index, const _It& what)
+    {
+        if (index == _Count)
+            this->AddRange(what);
+        else if (index < _Count)
+        {
+            std::size_t add_count = static_cast<std::size_t>(std::distance(what.begin(), what.end()));
+
+            // Same approach as List<T, Allocator, Growth>::InsertRange: either a new block receives both halves around the new
+            // items, or the items after the place of insertion make room in place
+            if (add_count > _Capacity - _Count)
+            {
+                std::size_t new_capacity = _NextCapacity(_Count + add_count);
+                T* new_Elems = _Allocate(new_capacity);
+
+                try
+                {
+                    UninitializedCopy(what.begin(), what.end(), &new_Elems[index]);
+                }
+                catch (...)
+                {
+                    _AllocTraits::deallocate(_Alloc, new_Elems, new_capacity);
+                    throw;
+                }
+
+                UninitializedRelocate(_Elems, &_Elems[index], new_Elems);
+                UninitializedRelocate(&_Elems[index], &_Elems[_Count], &new_Elems[index + add_count]);
+
+                _Deallocate(_Elems, _Capacity);
+                _Elems = new_Elems;
+                _Capacity = new_capacity;
+            }
+            else if (_IsBulkRelocatable())
+            {
+                _ShiftElements(index, index + add_count);
+
+                try
+                {
+                    UninitializedCopy(what.begin(), what.end(), &_Elems[index]);
+                }
+                catch (...)
+                {
+                    _ShiftElements(index + add_count, index);
+                    throw;
+                }
+            }
+            else
+            {
+                UninitializedDefaultConstruct(&_Elems[_Count], add_count);
+                std::move_backward(&_Elems[index], &_Elems[_Count], &_Elems[_Count + add_count]);
+                std::copy(what.begin(), what.end(), &_Elems[index]);
+            }
+
+            _Count += add_count;
+        }
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr void InlineList<T, N, Allocator, Growth>::InsertRange(std::size_t index, _It&& what)
+    {
+        if (index == _Count)
+            this->AddRange(std::move(what));
+        else if (index < _Count)
+        {
+            std::size_t add_count = static_cast<std::size_t>(std::distance(what.begin(), what.end()));
+
+            if (add_count > _Capacity - _Count)
+            {
+                std::size_t new_capacity = _NextCapacity(_Count + add_count);
+                T* new_Elems = _Allocate(new_capacity);
+
+                try
+                {
+                    UninitializedMove(what.begin(), what.end(), &new_Elems[index]);
+                }
+                catch (...)
+                {
+                    _AllocTraits::deallocate(_Alloc, new_Elems, new_capacity);
+                    throw;
+                }
+
+                UninitializedRelocate(_Elems, &_Elems[index], new_Elems);
+                UninitializedRelocate(&_Elems[index], &_Elems[_Count], &new_Elems[index + add_count]);
+
+                _Deallocate(_Elems, _Capacity);
+                _Elems = new_Elems;
+                _Capacity = new_capacity;
+            }
+            else if (_IsBulkRelocatable())
+            {
+                _ShiftElements(index, index + add_count);
+
+                try
+                {
+                    UninitializedMove(what.begin(), what.end(), &_Elems[index]);
+                }
+                catch (...)
+                {
+                    _ShiftElements(index + add_count, index);
+                    throw;
+                }
+            }
+            else
+            {
+                UninitializedDefaultConstruct(&_Elems[_Count], add_count);
+                std::move_backward(&_Elems[index], &_Elems[_Count], &_Elems[_Count + add_count]);
+                std::move(what.begin(), what.end(), &_Elems[index]);
+            }
+
+            _Count += add_count;
+        }
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::InsertSorted(const T& what, _Compare compare)
+    {
+        std::size_t index = UpperBound<_Compare>(what, compare);
+        Insert(index, what);
+
+        return index;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::InsertSorted(T&& what, _Compare compare)
+    {
+        std::size_t index = UpperBound<_Compare>(what, compare);
+        Insert(index, std::move(what));
+
+        return index;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::LowerBound(const T& what, _Compare compare) const
+    {
+        return Container::LowerBound<T, InlineList<T, N, Allocator, Growth>, _Compare>(*this, what, compare);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void InlineList<T, N, Allocator, Growth>::MergeSorted(const _It& other, _Compare compare)
+    {
+        auto first = other.begin(), last = other.end();
+
+        // Same approach as List<T, Allocator, Growth>::MergeSorted: the items of this list are moved over to the merged list
+        // unless they are the very ones being merged in
+        bool aliased = std::is_constant_evaluated();
+        if constexpr (std::contiguous_iterator<decltype(first)>)
+        {
+            if (!aliased && first != last)
+            {
+                const T* other_first = std::to_address(first);
+                aliased = std::less_equal<const T*>{}(_Elems, other_first) && std::less<const T*>{}(other_first, &_Elems[_Count]);
+            }
+        }
+
+        InlineList<T, N, Allocator, Growth> merged(_Alloc);
+        merged.Reserve(_Count + static_cast<std::size_t>(std::distance(first, last)));
+
+        auto take = [&](std::size_t index)
+        {
+            if (aliased)
+                merged.Emplace(std::as_const(_Elems[index]));
+            else
+                merged.Emplace(std::move(_Elems[index]));
+        };
+
+        std::size_t index = 0;
+        while (index < _Count && first != last)
+        {
+            if (std::invoke(compare, *first, std::as_const(_Elems[index])))
+                merged.Emplace(*first++);
+            else
+                take(index++);
+        }
+
+        for (; index < _Count; index++)
+            take(index);
+        for (; first != last; ++first)
+            merged.Emplace(*first);
+
+        Swap(merged);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::RemoveAll(_Predicate match)
+    {
+        std::size_t kept = 0;
+        while (kept < _Count && !std::invoke(match, std::as_const(_Elems[kept])))
+            kept++;
+
+        for (std::size_t i = kept + 1; i < _Count; i++)
+            if (!std::invoke(match, std::as_const(_Elems[i])))
+                _Elems[kept++] = std::move(_Elems[i]);
+
+        std::size_t removed = _Count - kept;
+        std::destroy(_Elems + kept, _Elems + _Count);
+        _Count = kept;
+
+        return removed;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void InlineList<T, N, Allocator, Growth>::Sort(_Compare compare)
+    {
+        Container::Sort<InlineList<T, N, Allocator, Growth>, T, _Compare>(*this, compare);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <ThreeWayComparison<T> _Compare>
+    constexpr void InlineList<T, N, Allocator, Growth>::Sort(_Compare compare)
+    {
+        Container::Sort<InlineList<T, N, Allocator, Growth>, T, _Compare>(*this, compare);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::UpperBound(const T& what, _Compare compare) const
+    {
+        return Container::UpperBound<T, InlineList<T, N, Allocator, Growth>, _Compare>(*this, what, compare);
+    }
+
+    // InlineList<T, N, Allocator, Growth> - Iterators
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T* InlineList<T, N, Allocator, Growth>::begin() const noexcept
+    {
+        return _Elems;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T* InlineList<T, N, Allocator, Growth>::end() const noexcept
+    {
+        return _Elems + _Count;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr const T* InlineList<T, N, Allocator, Growth>::cbegin() const noexcept
+    {
+        return _Elems;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr const T* InlineList<T, N, Allocator, Growth>::cend() const noexcept
+    {
+        return _Elems + _Count;
+    }
+
+    // InlineList<T, N, Allocator, Growth> - Operators
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>& InlineList<T, N, Allocator, Growth>::operator=(const InlineList<T, N, Allocator, Growth>& other)
+    {
+        if (this == &other)
+            return *this;
+
+        Clear();
+
+        if constexpr (_AllocTraits::propagate_on_container_copy_assignment::value)
+        {
+            // The memory held so far has to be given back to the allocator it came from before that allocator is replaced
+            if (!_AllocTraits::is_always_equal::value && _Alloc != other._Alloc)
+            {
+                _Release();
+                _ResetToInline();
+            }
+
+            _Alloc = other._Alloc;
+        }
+
+        AddRange(other);
+        return *this;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>& InlineList<T, N, Allocator, Growth>::operator=(InlineList<T, N, Allocator, Growth>&& other)
+    {
+        if (this == &other)
+            return *this;
+
+        Clear();
+
+        bool can_steal = _AllocTraits::is_always_equal::value || _Alloc == other._Alloc;
+        if constexpr (_AllocTraits::propagate_on_container_move_assignment::value)
+        {
+            if (!can_steal)
+            {
+                _Release();
+                _ResetToInline();
+            }
+
+            _Alloc = std::move(other._Alloc);
+            can_steal = true;
+        }
+
+        _StealOrMove(other, can_steal);
+        return *this;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T& InlineList<T, N, Allocator, Growth>::operator[](std::size_t index)
+    {
+        if (index < _Count)
+            return _Elems[index];
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr const T& InlineList<T, N, Allocator, Growth>::operator[](std::size_t index) const
+    {
+        if (index < _Count)
+            return _Elems[index];
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr bool InlineList<T, N, Allocator, Growth>::operator==(const InlineList<T, N, Allocator, Growth>& other) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>
+    {
+        return (_Count == other._Count && std::equal(_Elems, _Elems + _Count, other._Elems));
+    }
+
+    // InlineList<T, N, Allocator, Growth> - Destructor
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr InlineList<T, N, Allocator, Growth>::~InlineList() noexcept(std::is_nothrow_destructible_v<T>)
+    {
+        _Release();
+    }
+
+    // InlineList<T, N, Allocator, Growth> - Protected Member Functions
+
+    /// @brief Address of the inline storage, or null during constant evaluation, where the storage cannot hold objects.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T* InlineList<T, N, Allocator, Growth>::_InlineElems() const noexcept
+    {
+        if (std::is_constant_evaluated())
+            return nullptr;
+
+        return reinterpret_cast<T*>(const_cast<unsigned char*>(_Inline));
+    }
+
+    /// @brief Points the list back at its (empty) inline storage without releasing anything.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::_ResetToInline() noexcept
+    {
+        _Elems = _InlineElems();
+        _Capacity = _Elems ? N : 0;
+        _Count = 0;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr T* InlineList<T, N, Allocator, Growth>::_Allocate(std::size_t n)
+    {
+        return _AllocTraits::allocate(_Alloc, n);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::_Deallocate(T* where, std::size_t n) noexcept
+    {
+        if (where && where != _InlineElems())
+            _AllocTraits::deallocate(_Alloc, where, n);
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t InlineList<T, N, Allocator, Growth>::_NextCapacity(std::size_t min_capacity) const noexcept
+    {
+        // Never less than the inline storage holds, which constant evaluation does not use
+        return std::max(Growth::NextCapacity(_Capacity, min_capacity, sizeof(T)), N);
+    }
+
+    /// @brief Moves the items to allocated memory for exactly the given number of items.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::_Reallocate(std::size_t new_capacity)
+    {
+        T* new_Elems = _Allocate(new_capacity);
+        UninitializedRelocate(_Elems, _Elems + _Count, new_Elems);
+
+        _Deallocate(_Elems, _Capacity);
+        _Elems = new_Elems;
+        _Capacity = new_capacity;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::_Reserve(std::size_t min_capacity)
+    {
+        if (min_capacity > _Capacity)
+            _Reallocate(_NextCapacity(min_capacity));
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::_Release() noexcept(std::is_nothrow_destructible_v<T>)
+    {
+        std::destroy_n(_Elems, _Count);
+        _Deallocate(_Elems, _Capacity);
+    }
+
+    /// @brief Moves the items in [from, _Count) bytewise so that they start at index `to`. Only valid for trivially relocatable
+    /// items; the vacated slots are left as uninitialized storage.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::_ShiftElements(std::size_t from, std::size_t to) noexcept
+    {
+        std::memmove(static_cast<void*>(&_Elems[to]), static_cast<const void*>(&_Elems[from]), (_Count - from) * sizeof(T));
+    }
+
+    /// @brief Takes over the items of the other list, leaving it empty, while this list is empty. Allocated memory changes hands
+    /// if allowed; items held inline, or in memory this list's allocator cannot deallocate, are moved one by one.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr void InlineList<T, N, Allocator, Growth>::_StealOrMove(InlineList<T, N, Allocator, Growth>& other, bool can_steal)
+    {
+        if (can_steal && !other.IsInline())
+        {
+            _Deallocate(_Elems, _Capacity);
+
+            _Elems = other._Elems;
+            _Capacity = other._Capacity;
+            _Count = other._Count;
+            other._ResetToInline();
+        }
+        else
+        {
+            _Reserve(other._Count);
+
+            if (other.IsInline())
+                UninitializedRelocate(other._Elems, other._Elems + other._Count, _Elems);
+            else
+            {
+                UninitializedMove(other._Elems, other._Elems + other._Count, _Elems);
+                std::destroy_n(other._Elems, other._Count);
+            }
+
+            _Count = std::exchange(other._Count, 0);
+        }
+    }
+
+    /// @brief Moves the items to a block grown by the growth policy, with an item constructed from the arguments at the given
+    /// index. The item is constructed first, in case the arguments refer to items of this list. Leaves _Count to the caller.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <class... Args>
+    constexpr void InlineList<T, N, Allocator, Growth>::_EmplaceReallocating(std::size_t index, Args&&... args)
+    {
+        std::size_t new_capacity = _NextCapacity(_Count + 1);
+        T* new_Elems = _Allocate(new_capacity);
+
+        try
+        {
+            std::construct_at(&new_Elems[index], std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            _AllocTraits::deallocate(_Alloc, new_Elems, new_capacity);
+            throw;
+        }
+
+        UninitializedRelocate(_Elems, &_Elems[index], new_Elems);
+        UninitializedRelocate(&_Elems[index], &_Elems[_Count], &new_Elems[index + 1]);
+
+        _Deallocate(_Elems, _Capacity);
+        _Elems = new_Elems;
+        _Capacity = new_capacity;
+    }
+
+    /// @brief Constructs an item from `what` at the given index. When the list is full the item is constructed in the new block
+    /// first, so that `what` may refer to an item of this list.
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    template <class U>
+    constexpr void InlineList<T, N, Allocator, Growth>::_InsertOne(std::size_t index, U&& what)
+    {
+        if (index > _Count)
+            throw std::out_of_range("index");
+
+        if (_Count == _Capacity)
+            _EmplaceReallocating(index, std::forward<U>(what));
+        else if (index == _Count)
+            std::construct_at(&_Elems[index], std::forward<U>(what));
+        else if (_IsBulkRelocatable())
+        {
+            auto* source = std::addressof(what);
+            _ShiftElements(index, index + 1);
+
+            // Shifting has moved the new item one place further if it is part of the shifted items
+            if (std::less_equal<const T*>{}(&_Elems[index], source) && std::less<const T*>{}(source, &_Elems[_Count]))
+                source++;
+
+            try
+            {
+                std::construct_at(&_Elems[index], std::forward<U>(*source));
+            }
+            catch (...)
+            {
+                _ShiftElements(index + 1, index);
+                throw;
+            }
+        }
+        else
+        {
+            // Made beforehand since shifting would change the item if it belongs to this list
+            T item(std::forward<U>(what));
+
+            std::construct_at(&_Elems[_Count], std::move(_Elems[_Count - 1]));
+            std::move_backward(&_Elems[index], &_Elems[_Count - 1], &_Elems[_Count]);
+            _Elems[index] = std::move(item);
+        }
+
+        _Count++;
+    }
+
+    template <class T, std::size_t N, class Allocator, GrowthPolicy Growth>
+    constexpr bool InlineList<T, N, Allocator, Growth>::_IsBulkRelocatable() noexcept
+    {
+        return is_trivially_relocatable_v<T> && !std::is_constant_evaluated();
+    }
+};
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "base_include.hpp"
+
+// Set to 1, for the whole program (the CMake option CQUE_INSTRUMENTATION does so), to have List and Any count their allocations
+// and item transfers. At 0, the default, the counting compiles to nothing.
+#ifndef CQUE_INSTRUMENTATION
+#define CQUE_INSTRUMENTATION 0
+#endif
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue::Instrumentation
+{
+    enum class Counter : std::size_t
+    {
+        /// @brief Blocks allocated by lists.
+        ListAllocations,
+        /// @brief Times a list moved its items to a new block, each one a candidate for Reserve.
+        ListReallocations,
+        /// @brief Items moved by lists, to a new block or within theirs by insertion and removal.
+        ListItemsMoved,
+        ListBytesMoved,
+        /// @brief Items copied into lists, by copying lists or adding items by const reference.
+        ListItemsCopied,
+        /// @brief Values stored inside Any objects.
+        AnyInlineStores,
+        /// @brief Values Any had to allocate heap storage for.
+        AnyHeapStores,
+        /// @brief BadCast exceptions thrown by Any for a type mismatch.
+        AnyBadCasts,
+    };
+
+    inline constexpr std::size_t CounterCount = static_cast<std::size_t>(Counter::AnyBadCasts) + 1;
+
+    inline constexpr bool Enabled = CQUE_INSTRUMENTATION;
+
+    struct Counters
+    {
+        std::uint64_t Values[CounterCount] = {};
+
+        constexpr std::uint64_t& operator[](Counter counter) noexcept { return Values[static_cast<std::size_t>(counter)]; }
+        constexpr std::uint64_t operator[](Counter counter) const noexcept { return Values[static_cast<std::size_t>(counter)]; }
+
+        constexpr Counters& operator+=(const Counters& other) noexcept;
+
+        /// @brief Counts between an earlier snapshot and this one.
+        constexpr Counters operator-(const Counters& earlier) const noexcept;
+    };
+
+    /// @brief Called on the recording thread for every event, after it is counted; e.g. capturing the call stack on
+    /// ListReallocations finds the lists which would rather Reserve. Must not throw, and should not use List or Any itself.
+    using Hook = void (*)(Counter counter, std::uint64_t amount) noexcept;
+
+    /// @brief Name of the counter as spelled in the enumeration, for reporting.
+    std::string_view NameOf(Counter counter) noexcept;
+
+    /// @brief Adds to the calling thread's counter and calls the hook, if any. Used by CQUE_RECORD.
+    void Record(Counter counter, std::uint64_t amount) noexcept;
+
+    /// @brief Zeroes the counters of every thread. Events recorded meanwhile by other threads may survive.
+    void Reset() noexcept;
+
+    /// @brief Installs the hook, or removes it given nullptr, and returns the previous one.
+    Hook SetHook(Hook hook) noexcept;
+
+    /// @brief Counts of the calling thread.
+    Counters ThreadTotals() noexcept;
+
+    /// @brief Counts of every thread, including those which have exited.
+    Counters Totals() noexcept;
+
+    /// @brief Records the event unless in constant evaluation, where nothing is counted.
+    constexpr void _Record(Counter counter, std::uint64_t amount) noexcept;
+};
+
+#if CQUE_INSTRUMENTATION
+#define CQUE_RECORD(_Counter, _Amount) ::CQue::Instrumentation::_Record(::CQue::Instrumentation::Counter::_Counter, static_cast<std::uint64_t>(_Amount))
+#else
+#define CQUE_RECORD(_Counter, _Amount) ((void)0)
+#endif
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue::Instrumentation
+{
+    // ********************************************* Counters *********************************************
+
+    constexpr Counters& Counters::operator+=(const Counters& other) noexcept
+    {
+        for (std::size_t i = 0; i < CounterCount; i++)
+            Values[i] += other.Values[i];
+
+        return *this;
+    }
+
+    constexpr Counters Counters::operator-(const Counters& earlier) const noexcept
+    {
+        Counters out;
+        for (std::size_t i = 0; i < CounterCount; i++)
+            out.Values[i] = Values[i] - earlier.Values[i];
+
+        return out;
+    }
+
+    // ****************************************** Free Functions ******************************************
+
+    constexpr void _Record(Counter counter, std::uint64_t amount) noexcept
+    {
+        if (!std::is_constant_evaluated())
+            Record(counter, amount);
+    }
+};
\ No newline at end of file
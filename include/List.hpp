@@ -4,76 +4,199 @@
 
 namespace CQue
 {
+    /// @brief Grows capacities by a factor of Numerator / Denominator, starting at MinimumCapacity items.
+    template <std::size_t Numerator, std::size_t Denominator = 1>
+    struct GeometricGrowth
+    {
+        static_assert(Denominator > 0 && Numerator > Denominator, "GeometricGrowth has to grow by a factor greater than 1");
+
+        static constexpr std::size_t MinimumCapacity = 4;
+
+        static constexpr std::size_t NextCapacity(std::size_t capacity, std::size_t required, std::size_t item_size) noexcept;
+    };
+
+    using DoublingGrowth = GeometricGrowth<2>;
+    using OneAndHalfGrowth = GeometricGrowth<3, 2>;
+
+    /// @brief Follows _Base, but once a block spans a page or more, rounds it up to whole pages so that none of the memory the
+    /// allocator has to set aside goes unused.
+    template <GrowthPolicy _Base = DoublingGrowth, std::size_t PageSize = 4096>
+    struct PageRoundedGrowth
+    {
+        static constexpr std::size_t NextCapacity(std::size_t capacity, std::size_t required, std::size_t item_size) noexcept;
+    };
+
     /// @brief A contiguous, array-based collection equipped with indexing and some helper methods.
     /// The member functions' names are unashamedly given due to .NET generic collection library.
     /// @tparam T 
-    template <class T, class Allocator = std::allocator<T>>
+    /// @tparam Growth How much room to make whenever the list runs out of it
+    template <class T, class Allocator = std::allocator<T>, GrowthPolicy Growth = DoublingGrowth>
     class List
     {
     public:
         // Constructors
 
-        constexpr List() noexcept;
-        constexpr List(const List<T, Allocator>& other) noexcept(std::is_nothrow_copy_constructible_v<T>);
-        constexpr List(List<T, Allocator>&& other) noexcept;
+        constexpr List() noexcept(std::is_nothrow_default_constructible_v<Allocator>);
+        constexpr explicit List(const Allocator& alloc) noexcept;
+        constexpr List(const List<T, Allocator, Growth>& other) noexcept(std::is_nothrow_copy_constructible_v<T>);
+        constexpr List(const List<T, Allocator, Growth>& other, const Allocator& alloc) noexcept(std::is_nothrow_copy_constructible_v<T>);
+        constexpr List(List<T, Allocator, Growth>&& other) noexcept;
+        constexpr List(List<T, Allocator, Growth>&& other, const Allocator& alloc) noexcept(std::allocator_traits<Allocator>::is_always_equal::value);
 
-        constexpr List(std::size_t initial_size) noexcept(std::is_nothrow_default_constructible_v<T>) requires std::default_initializable<T>;
-        constexpr List(std::initializer_list<T> lst) noexcept(std::is_nothrow_copy_constructible_v<T>);
+        constexpr List(std::size_t initial_size, const Allocator& alloc = Allocator()) noexcept(std::is_nothrow_default_constructible_v<T>) requires std::default_initializable<T>;
+        constexpr List(std::initializer_list<T> lst, const Allocator& alloc = Allocator()) noexcept(std::is_nothrow_copy_constructible_v<T>);
 
         template <ForwardIterableObjectOf<T> _It>
-        constexpr List(const _It& lst) noexcept(std::is_nothrow_copy_constructible_v<T>);
+        constexpr List(const _It& lst, const Allocator& alloc = Allocator()) noexcept(std::is_nothrow_copy_constructible_v<T>);
 
-        template <ForwardIterableObjectOf<T> _It>
-        constexpr List(_It&& lst) noexcept(std::is_nothrow_move_constructible_v<T>);
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+        constexpr List(_It&& lst, const Allocator& alloc = Allocator()) noexcept(std::is_nothrow_move_constructible_v<T>);
 
         template <std::forward_iterator _It>
-        constexpr List(_It first, _It last) noexcept(std::is_nothrow_copy_constructible_v<T>);
+        constexpr List(_It first, _It last, const Allocator& alloc = Allocator()) noexcept(std::is_nothrow_copy_constructible_v<T>);
 
         // Non-Template Member Functions
 
         constexpr void Add(const T& what) noexcept(std::is_nothrow_copy_assignable_v<T>&& std::is_nothrow_move_assignable_v<T>);
         constexpr void Add(T&& what) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        /// @brief Item at the index, throwing std::out_of_range past the end, as operator[] does.
+        constexpr T& At(std::size_t index);
+        constexpr const T& At(std::size_t index) const;
+
+
+        /// @brief Searches the list, sorted in ascending order, for the item. Returns its index or, if it is not there, the bitwise
+        /// complement of the index at which it would be inserted; see Container::BinarySearch.
+        constexpr std::size_t BinarySearch(const T& what) const;
+
         constexpr std::size_t Capacity() const noexcept;
         constexpr void Clear() noexcept(std::is_nothrow_destructible_v<T>);
-        constexpr bool Contains(const T& what) const noexcept(std::declval<T>() == std::declval<T>()) requires std::equality_comparable<T>;
+        constexpr bool Contains(const T& what) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>;
         constexpr std::size_t Count() const noexcept;
+
+        /// @brief Pointer to the first of Count() contiguous items; may be null while there are none.
+        constexpr T* Data() noexcept;
+        constexpr const T* Data() const noexcept;
+
         constexpr bool Exists(Predicate<const T&> match) const;
         constexpr T Find(Predicate<const T&> match) const;
-        constexpr List<T, Allocator> FindAll(Predicate<const T&> match) const;
+        constexpr List<T, Allocator, Growth> FindAll(Predicate<const T&> match) const;
         constexpr std::size_t FindIndex(Predicate<const T&> match) const;
         constexpr T FindLast(Predicate<const T&> match) const;
         constexpr std::size_t FindLastIndex(Predicate<const T&> match) const;
+        constexpr Allocator GetAllocator() const noexcept;
         constexpr std::size_t IndexOf(const T& what) const noexcept;
         constexpr void Insert(std::size_t index, const T& what);
         constexpr void Insert(std::size_t index, T&& what);
+
+        /// @brief Inserts the item into the list, sorted in ascending order, after the items equivalent to it and returns its index.
+        constexpr std::size_t InsertSorted(const T& what);
+        constexpr std::size_t InsertSorted(T&& what);
+
         constexpr std::size_t LastIndexOf(const T& what) const noexcept;
+        constexpr std::size_t LowerBound(const T& what) const;
         constexpr bool Remove(const T& what) noexcept;
+        constexpr std::size_t RemoveAll(Predicate<const T&> match);
         constexpr void RemoveAt(std::size_t index);
         constexpr void RemoveRange(std::size_t index, std::size_t count);
-        constexpr void Resize(std::size_t n) noexcept requires std::default_initializable<T>;
+
+        /// @brief Makes room for at least the given number of items, allocating exactly that many if there is not enough.
+        constexpr void Reserve(std::size_t capacity);
+
+        constexpr void Resize(std::size_t n) requires std::default_initializable<T>;
         constexpr void Reverse() noexcept(std::is_nothrow_move_assignable_v<T>);
-        constexpr void Sort(Comparison<T> compare = &DefaultCompare<T>);
+
+        /// @brief Reallocates to exactly the number of items held, or frees the memory if there are none.
+        constexpr void ShrinkToFit();
+
+        constexpr void Sort();
+        constexpr void Sort(Comparison<T> compare);
+        constexpr void Swap(List<T, Allocator, Growth>& other) noexcept;
+
+        /// @brief Item at the index with no bounds check, for loops which already keep the index within Count().
+        constexpr T& UnsafeAt(std::size_t index) noexcept;
+        constexpr const T& UnsafeAt(std::size_t index) const noexcept;
+        constexpr std::size_t UpperBound(const T& what) const;
 
         // Template Member Functions
 
         template <ForwardIterableObjectOf<T> _It>
         constexpr void AddRange(const _It& what) noexcept(std::is_nothrow_copy_assignable_v<T>&& std::is_nothrow_move_assignable_v<T>);
 
-        template <ForwardIterableObjectOf<T> _It>
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
         constexpr void AddRange(_It&& what) noexcept(std::is_nothrow_move_assignable_v<T>);
 
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t BinarySearch(const T& what, _Compare compare) const;
+
         template <class TOutput>
-        constexpr List<TOutput> ConvertAll(Converter<T, TOutput> converter = &DefaultConvert<T, TOutput>) const;
+        constexpr List<TOutput, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> ConvertAll(Converter<T, TOutput> converter = &DefaultConvert<T, TOutput>) const;
+
+        template <class TOutput, ConverterOf<T, TOutput> _Converter>
+        constexpr List<TOutput, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> ConvertAll(_Converter converter) const;
 
         template <ForwardIterableObjectOf<T> _It>
         constexpr void CopyTo(_It& where) const noexcept(std::is_nothrow_copy_assignable_v<T>);
 
+        /// @brief Constructs an item from the given arguments at the end of the list and returns it.
+        template <class... Args> requires std::constructible_from<T, Args...>
+        constexpr T& Emplace(Args&&... args);
+
+        /// @brief Constructs an item from the given arguments at the given index and returns it.
+        template <class... Args> requires std::constructible_from<T, Args...>
+        constexpr T& EmplaceAt(std::size_t index, Args&&... args);
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr bool Exists(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr T Find(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr List<T, Allocator, Growth> FindAll(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t FindIndex(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr T FindLast(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t FindLastIndex(_Predicate match) const;
+
         template <ForwardIterableObjectOf<T> _It>
         constexpr void InsertRange(std::size_t index, const _It& what);
 
-        template <ForwardIterableObjectOf<T> _It>
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
         constexpr void InsertRange(std::size_t index, _It&& what);
 
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t InsertSorted(const T& what, _Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t InsertSorted(T&& what, _Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t LowerBound(const T& what, _Compare compare) const;
+
+        /// @brief Merges the items of another sorted container into this sorted list in linear time, keeping it sorted. Of 
+        /// equivalent items, those of this list come first.
+        template <ForwardIterableObjectOf<T> _It, std::strict_weak_order<const T&, const T&> _Compare = DefaultComparer<T>>
+        constexpr void MergeSorted(const _It& other, _Compare compare = _Compare());
+
+        /// @brief Removes every item matching the predicate in a single stable pass and returns how many were removed.
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t RemoveAll(_Predicate match);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr void Sort(_Compare compare);
+
+        template <ThreeWayComparison<T> _Compare>
+        constexpr void Sort(_Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t UpperBound(const T& what, _Compare compare) const;
+
         // Iterators
 
         constexpr T* begin() const noexcept;
@@ -83,251 +206,370 @@ namespace CQue
 
         // Operators
 
-        constexpr List<T, Allocator>& operator=(const List<T, Allocator>& other);
-        constexpr List<T, Allocator>& operator=(List<T, Allocator>&& other);
+        constexpr List<T, Allocator, Growth>& operator=(const List<T, Allocator, Growth>& other);
+        constexpr List<T, Allocator, Growth>& operator=(List<T, Allocator, Growth>&& other);
 
         constexpr T& operator[](std::size_t index);
         constexpr const T& operator[](std::size_t index) const;
 
-        constexpr bool operator==(const List<T, Allocator>& other) const noexcept(std::declval<T>() == std::declval<T>()) requires std::equality_comparable<T>;
+        constexpr bool operator==(const List<T, Allocator, Growth>& other) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>;
 
         // Destructor
 
         constexpr ~List() noexcept(std::is_nothrow_destructible_v<T>);
 
     protected:
+        using _AllocTraits = std::allocator_traits<Allocator>;
+
+        constexpr T* _Allocate(std::size_t n);
+        constexpr void _Deallocate(T* where, std::size_t n) noexcept;
+        constexpr std::size_t _NextCapacity(std::size_t required) const noexcept;
         constexpr void _Reallocate(std::size_t new_capacity) noexcept(std::is_nothrow_move_constructible_v<T>&& std::is_nothrow_destructible_v<T>);
+        constexpr void _RecordMoves(std::size_t count) const noexcept;
         constexpr void _Release() noexcept(std::is_nothrow_destructible_v<T>);
+        constexpr void _ShiftElements(std::size_t from, std::size_t to) noexcept;
+        constexpr bool _TryExpand(std::size_t new_capacity) noexcept;
+
+        template <class... Args>
+        constexpr void _EmplaceReallocating(std::size_t index, Args&&... args);
+
+        static constexpr bool _IsBulkRelocatable() noexcept;
+
+        // Declared first so that it is ready by the time the other members allocate in the constructors' initializer lists
+        CQUE_NO_UNIQUE_ADDRESS Allocator _Alloc;
 
         std::size_t _Capacity;
         std::size_t _Count;
         T* _Elems;
-
-        static inline Allocator _Alloc{};
     };
+
+    /// @brief List for millions of items: each list reserves PageAllocator<T>::DefaultReservation bytes of address space up
+    /// front and commits whole pages of it as it grows, so growing neither moves the items nor needs room for two copies of
+    /// them, and references to items stay valid until the reservation runs out.
+    template <class T>
+    using HugeList = List<T, PageAllocator<T>, PageRoundedGrowth<>>;
 };
 
 // ######################################## BODY DECLARATIONS #########################################
 
 namespace CQue
 {
-    // **************************************** List<T, Allocator> ****************************************
+    // ***************************** GeometricGrowth<Numerator, Denominator> ******************************
+
+    template <std::size_t Numerator, std::size_t Denominator>
+    constexpr std::size_t GeometricGrowth<Numerator, Denominator>::NextCapacity(std::size_t capacity, std::size_t required, std::size_t item_size) noexcept
+    {
+        // Saturates rather than overflows; the allocator then rejects the size
+        const std::size_t largest = std::numeric_limits<std::size_t>::max() / std::max<std::size_t>(item_size, 1);
+        std::size_t grown = (capacity <= largest / Numerator) ? capacity * Numerator / Denominator : largest;
+
+        return std::max({ required, grown, MinimumCapacity });
+    }
+
+    // ******************************** PageRoundedGrowth<_Base, PageSize> ********************************
+
+    template <GrowthPolicy _Base, std::size_t PageSize>
+    constexpr std::size_t PageRoundedGrowth<_Base, PageSize>::NextCapacity(std::size_t capacity, std::size_t required, std::size_t item_size) noexcept
+    {
+        std::size_t next = _Base::NextCapacity(capacity, required, item_size);
+
+        if (item_size == 0 || next > (std::numeric_limits<std::size_t>::max() - PageSize) / item_size || next * item_size < PageSize)
+            return next;
+
+        return (next * item_size + PageSize - 1) / PageSize * PageSize / item_size;
+    }
+
+    // ************************************ List<T, Allocator, Growth> ************************************
+
+    // List<T, Allocator, Growth> - Constructors
 
-    // List<T, Allocator> - Constructors
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List() noexcept(std::is_nothrow_default_constructible_v<Allocator>) : _Alloc(), _Capacity(0), _Count(0), _Elems(nullptr) {}
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>::List() noexcept : _Capacity(0), _Count(0), _Elems(nullptr) {}
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List(const Allocator& alloc) noexcept : _Alloc(alloc), _Capacity(0), _Count(0), _Elems(nullptr) {}
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>::List(const List<T, Allocator>& other) noexcept(std::is_nothrow_copy_constructible_v<T>) : _Capacity(other._Count), _Count(other._Count), _Elems(other._Elems ? _Alloc.allocate(other._Count) : nullptr)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List(const List<T, Allocator, Growth>& other) noexcept(std::is_nothrow_copy_constructible_v<T>) : List(other, _AllocTraits::select_on_container_copy_construction(other._Alloc)) {}
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List(const List<T, Allocator, Growth>& other, const Allocator& alloc) noexcept(std::is_nothrow_copy_constructible_v<T>) : _Alloc(alloc), _Capacity(other._Count), _Count(other._Count), _Elems(other._Count ? _Allocate(other._Count) : nullptr)
     {
-        for (std::size_t i = 0; i < other._Count; i++)
-            std::construct_at(&_Elems[i], other._Elems[i]);
+        CQUE_RECORD(ListItemsCopied, other._Count);
+        UninitializedCopy(other._Elems, &other._Elems[other._Count], _Elems);
     }
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>::List(List<T, Allocator>&& other) noexcept : _Capacity(std::exchange(other._Capacity, 0)), _Count(std::exchange(other._Count, 0)), _Elems(std::exchange(other._Elems, nullptr)) {}
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List(List<T, Allocator, Growth>&& other) noexcept : _Alloc(std::move(other._Alloc)), _Capacity(std::exchange(other._Capacity, 0)), _Count(std::exchange(other._Count, 0)), _Elems(std::exchange(other._Elems, nullptr)) {}
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List(List<T, Allocator, Growth>&& other, const Allocator& alloc) noexcept(std::allocator_traits<Allocator>::is_always_equal::value) : _Alloc(alloc), _Capacity(0), _Count(0), _Elems(nullptr)
+    {
+        // Memory can only change hands if this list's allocator is able to deallocate it, otherwise the items are moved one by one
+        if (_AllocTraits::is_always_equal::value || _Alloc == other._Alloc)
+        {
+            _Capacity = std::exchange(other._Capacity, 0);
+            _Count = std::exchange(other._Count, 0);
+            _Elems = std::exchange(other._Elems, nullptr);
+        }
+        else if (other._Count)
+        {
+            _Elems = _Allocate(other._Count);
+            _Capacity = other._Count;
+
+            _RecordMoves(other._Count);
+            UninitializedMove(other._Elems, &other._Elems[other._Count], _Elems);
+            _Count = other._Count;
+            other.Clear();
+        }
+    }
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>::List(std::size_t initial_size) noexcept(std::is_nothrow_default_constructible_v<T>) requires std::default_initializable<T> : _Capacity(initial_size), _Count(initial_size), _Elems(_Alloc.allocate(initial_size))
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List(std::size_t initial_size, const Allocator& alloc) noexcept(std::is_nothrow_default_constructible_v<T>) requires std::default_initializable<T> : _Alloc(alloc), _Capacity(initial_size), _Count(initial_size), _Elems(_Allocate(initial_size))
     {
         UninitializedDefaultConstruct(_Elems, initial_size);
     }
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>::List(std::initializer_list<T> lst) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::List(std::initializer_list<T> lst, const Allocator& alloc) noexcept(std::is_nothrow_copy_constructible_v<T>) : _Alloc(alloc)
     {
         _Capacity = _Count = static_cast<std::size_t>(lst.end() - lst.begin());
-        _Elems = _Alloc.allocate(_Capacity);
+        _Elems = _Allocate(_Capacity);
 
+        CQUE_RECORD(ListItemsCopied, _Count);
         UninitializedCopy(lst.begin(), lst.end(), _Elems);
     }
 
-    template <class T, class Allocator>
+    template <class T, class Allocator, GrowthPolicy Growth>
     template <ForwardIterableObjectOf<T> _It>
-    constexpr List<T, Allocator>::List(const _It& lst) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    constexpr List<T, Allocator, Growth>::List(const _It& lst, const Allocator& alloc) noexcept(std::is_nothrow_copy_constructible_v<T>) : _Alloc(alloc)
     {
         _Capacity = _Count = static_cast<std::size_t>(lst.end() - lst.begin());
-        _Elems = _Alloc.allocate(_Capacity);
+        _Elems = _Allocate(_Capacity);
 
+        CQUE_RECORD(ListItemsCopied, _Count);
         UninitializedCopy(lst.begin(), lst.end(), _Elems);
     }
 
-    template <class T, class Allocator>
-    template <ForwardIterableObjectOf<T> _It>
-    constexpr List<T, Allocator>::List(_It&& lst) noexcept(std::is_nothrow_move_constructible_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr List<T, Allocator, Growth>::List(_It&& lst, const Allocator& alloc) noexcept(std::is_nothrow_move_constructible_v<T>) : _Alloc(alloc)
     {
         _Capacity = _Count = static_cast<std::size_t>(lst.end() - lst.begin());
-        _Elems = _Alloc.allocate(_Capacity);
+        _Elems = _Allocate(_Capacity);
 
         UninitializedMove(lst.begin(), lst.end(), _Elems);
     }
 
-    template <class T, class Allocator>
+    template <class T, class Allocator, GrowthPolicy Growth>
     template <std::forward_iterator _It>
-    constexpr List<T, Allocator>::List(_It first, _It last) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    constexpr List<T, Allocator, Growth>::List(_It first, _It last, const Allocator& alloc) noexcept(std::is_nothrow_copy_constructible_v<T>) : _Alloc(alloc)
     {
         _Capacity = _Count = static_cast<std::size_t>(last - first);
-        _Elems = _Alloc.allocate(_Capacity);
+        _Elems = _Allocate(_Capacity);
 
+        CQUE_RECORD(ListItemsCopied, _Count);
         UninitializedCopy(first, last, _Elems);
     }
 
-    // List<T, Allocator> - Non-Template Member Functions
+    // List<T, Allocator, Growth> - Non-Template Member Functions
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Add(const T& what) noexcept(std::is_nothrow_copy_assignable_v<T>&& std::is_nothrow_move_assignable_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Add(const T& what) noexcept(std::is_nothrow_copy_assignable_v<T>&& std::is_nothrow_move_assignable_v<T>)
     {
-        if (_Count == _Capacity)
-        {
-            if (_Capacity == 0)
-                _Elems = _Alloc.allocate(_Capacity = 1);
-            else
-                _Reallocate(_Capacity * 2);
-        }
+        CQUE_RECORD(ListItemsCopied, 1);
+        Emplace(what);
+    }
 
-        std::construct_at(&_Elems[_Count++], what);
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Add(T&& what) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        Emplace(std::move(what));
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Add(T&& what) noexcept(std::is_nothrow_move_assignable_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T& List<T, Allocator, Growth>::At(std::size_t index)
     {
-        if (_Count == _Capacity)
-        {
-            if (_Capacity == 0)
-                _Elems = _Alloc.allocate(_Capacity = 1);
-            else
-                _Reallocate(_Capacity * 2);
-        }
+        return (*this)[index];
+    }
 
-        std::construct_at(&_Elems[_Count++], std::move(what));
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr const T& List<T, Allocator, Growth>::At(std::size_t index) const
+    {
+        return (*this)[index];
     }
 
-    template <class T, class Allocator>
-    constexpr std::size_t List<T, Allocator>::Capacity() const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::BinarySearch(const T& what) const
+    {
+        return BinarySearch<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::Capacity() const noexcept
     {
         return _Capacity;
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Clear() noexcept(std::is_nothrow_destructible_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Clear() noexcept(std::is_nothrow_destructible_v<T>)
     {
         std::destroy_n(_Elems, _Count);
         _Count = 0;
     }
 
-    template <class T, class Allocator>
-    constexpr bool List<T, Allocator>::Contains(const T& what) const noexcept(std::declval<T>() == std::declval<T>()) requires std::equality_comparable<T>
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr bool List<T, Allocator, Growth>::Contains(const T& what) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>
     {
-        for (std::size_t i = 0; i < _Count; i++)
-            if (_Elems[i] == what)
-                return true;
-
-        return false;
+        return (IndexOf(what) != (std::size_t)(-1));
     }
 
-    template <class T, class Allocator>
-    constexpr std::size_t List<T, Allocator>::Count() const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::Count() const noexcept
     {
         return _Count;
     }
 
-    template <class T, class Allocator>
-    constexpr bool List<T, Allocator>::Exists(Predicate<const T&> match) const
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T* List<T, Allocator, Growth>::Data() noexcept
     {
-        return Container::Exists<T>(*this, match);
+        return _Elems;
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr const T* List<T, Allocator, Growth>::Data() const noexcept
+    {
+        return _Elems;
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr bool List<T, Allocator, Growth>::Exists(Predicate<const T&> match) const
+    {
+        return Exists<Predicate<const T&>>(match);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T List<T, Allocator, Growth>::Find(Predicate<const T&> match) const
+    {
+        return Find<Predicate<const T&>>(match);
     }
 
-    template <class T, class Allocator>
-    constexpr T List<T, Allocator>::Find(Predicate<const T&> match) const
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth> List<T, Allocator, Growth>::FindAll(Predicate<const T&> match) const
     {
-        return Container::Find<T>(*this, match);
+        return FindAll<Predicate<const T&>>(match);
     }
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator> List<T, Allocator>::FindAll(Predicate<const T&> match) const
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::FindIndex(Predicate<const T&> match) const
     {
-        return Container::FindAll<T>(*this, match);
+        return FindIndex<Predicate<const T&>>(match);
     }
 
-    template <class T, class Allocator>
-    constexpr std::size_t List<T, Allocator>::FindIndex(Predicate<const T&> match) const
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T List<T, Allocator, Growth>::FindLast(Predicate<const T&> match) const
     {
-        return Container::FindIndex<T>(*this, match);
+        return FindLast<Predicate<const T&>>(match);
     }
 
-    template <class T, class Allocator>
-    constexpr T List<T, Allocator>::FindLast(Predicate<const T&> match) const
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::FindLastIndex(Predicate<const T&> match) const
     {
-        return Container::FindLast<T>(*this, match);
+        return FindLastIndex<Predicate<const T&>>(match);
     }
 
-    template <class T, class Allocator>
-    constexpr std::size_t List<T, Allocator>::FindLastIndex(Predicate<const T&> match) const
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr Allocator List<T, Allocator, Growth>::GetAllocator() const noexcept
     {
-        return Container::FindLastIndex<T>(match);
+        return _Alloc;
     }
 
-    template <class T, class Allocator>
-    constexpr std::size_t List<T, Allocator>::IndexOf(const T& what) const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::IndexOf(const T& what) const noexcept
     {
         return Container::IndexOf<T>(*this, what);
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Insert(std::size_t index, const T& what)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Insert(std::size_t index, const T& what)
     {
         if (index == _Count)
             this->Add(what);
         else if (index < _Count)
         {
-            if (_Count == _Capacity)
-            {
-                T* new_Elems = _Alloc.allocate(_Capacity * 2);
-
-                UninitializedMove(_Elems, &_Elems[index], new_Elems);
-                std::construct_at(&new_Elems[index], what);
-                UninitializedMove(&_Elems[index], &_Elems[_Count], &new_Elems[index + 1]);
-
-                _Release();
+            CQUE_RECORD(ListItemsCopied, 1);
 
-                _Elems = new_Elems;
-                _Capacity *= 2;
+            if (_Count == _Capacity && !_TryExpand(_NextCapacity(_Count + 1)))
+                _EmplaceReallocating(index, what);
+            else if (_IsBulkRelocatable())
+            {
+                const T* source = std::addressof(what);
+                _ShiftElements(index, index + 1);
+
+                // Shifting has moved the new item one place further if it is part of the shifted items
+                if (std::less_equal<const T*>{}(&_Elems[index], source) && std::less<const T*>{}(source, &_Elems[_Count]))
+                    source++;
+
+                try
+                {
+                    std::construct_at(&_Elems[index], *source);
+                }
+                catch (...)
+                {
+                    _ShiftElements(index + 1, index);
+                    throw;
+                }
             }
             else
             {
+                // Copied beforehand since shifting would change the item if it belongs to this list
+                T item(what);
+
+                _RecordMoves(_Count - index);
                 std::construct_at(&_Elems[_Count], std::move(_Elems[_Count - 1]));
-                std::move_backward(&_Elems[index], &_Elems[_Count - 1], &_Elems[_Count - 1]);
-                _Elems[index] = what;
+                std::move_backward(&_Elems[index], &_Elems[_Count - 1], &_Elems[_Count]);
+                _Elems[index] = std::move(item);
             }
 
             _Count++;
         }
+        else
+            throw std::out_of_range("index");
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Insert(std::size_t index, T&& what)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Insert(std::size_t index, T&& what)
     {
         if (index == _Count)
             this->Add(std::move(what));
         else if (index < _Count)
         {
-            if (_Count == _Capacity)
+            if (_Count == _Capacity && !_TryExpand(_NextCapacity(_Count + 1)))
+                _EmplaceReallocating(index, std::move(what));
+            else if (_IsBulkRelocatable())
             {
-                T* new_Elems = _Alloc.allocate(_Capacity * 2);
-
-                UninitializedMove(_Elems, &_Elems[index], new_Elems);
-                std::construct_at(&new_Elems[index], std::move(what));
-                UninitializedMove(&_Elems[index], &_Elems[_Count], &new_Elems[index + 1]);
-
-                _Release();
-                _Capacity *= 2;
-                _Elems = new_Elems;
+                T* source = std::addressof(what);
+                _ShiftElements(index, index + 1);
+
+                // Shifting has moved the new item one place further if it is part of the shifted items
+                if (std::less_equal<const T*>{}(&_Elems[index], source) && std::less<const T*>{}(source, &_Elems[_Count]))
+                    source++;
+
+                try
+                {
+                    std::construct_at(&_Elems[index], std::move(*source));
+                }
+                catch (...)
+                {
+                    _ShiftElements(index + 1, index);
+                    throw;
+                }
             }
             else
             {
+                _RecordMoves(_Count - index);
                 std::construct_at(&_Elems[_Count], std::move(_Elems[_Count - 1]));
-                std::move_backward(&_Elems[index], &_Elems[_Count - 1], &_Elems[_Count - 1]);
+                std::move_backward(&_Elems[index], &_Elems[_Count - 1], &_Elems[_Count]);
                 _Elems[index] = std::move(what);
             }
 
@@ -338,14 +580,32 @@ namespace CQue
             throw std::out_of_range("index");
     }
 
-    template <class T, class Allocator>
-    constexpr std::size_t List<T, Allocator>::LastIndexOf(const T& what) const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::InsertSorted(const T& what)
+    {
+        return InsertSorted<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::InsertSorted(T&& what)
+    {
+        return InsertSorted<DefaultComparer<T>>(std::move(what), DefaultComparer<T>{});
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::LastIndexOf(const T& what) const noexcept
     {
         return Container::LastIndexOf<T>(*this, what);
     }
 
-    template <class T, class Allocator>
-    constexpr bool List<T, Allocator>::Remove(const T& what) noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::LowerBound(const T& what) const
+    {
+        return LowerBound<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr bool List<T, Allocator, Growth>::Remove(const T& what) noexcept
     {
         try
         {
@@ -364,130 +624,344 @@ namespace CQue
         }
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::RemoveAt(std::size_t index)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::RemoveAll(Predicate<const T&> match)
+    {
+        return RemoveAll<Predicate<const T&>>(match);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::RemoveAt(std::size_t index)
     {
         if (index < _Count)
         {
-            std::destroy_at(&_Elems[index]);
-            std::construct_at(&_Elems[index]);
-            std::move(&_Elems[index + 1], &_Elems[_Count], &_Elems[index]);
-            std::destroy_at(&_Elems[_Count--]);
+            if (_IsBulkRelocatable())
+            {
+                std::destroy_at(&_Elems[index]);
+                _ShiftElements(index + 1, index);
+                _Count--;
+            }
+            else
+            {
+                _RecordMoves(_Count - index - 1);
+                std::move(&_Elems[index + 1], &_Elems[_Count], &_Elems[index]);
+                std::destroy_at(&_Elems[--_Count]);
+            }
         }
         else
             throw std::out_of_range("where");
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::RemoveRange(std::size_t index, std::size_t count)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::RemoveRange(std::size_t index, std::size_t count)
     {
         if (index + count <= _Count)
         {
-            std::destroy_n(&_Elems[index], count);
-            UninitializedDefaultConstruct(&_Elems[index], count);
+            // Nothing to remove; also spares the items from being move-assigned onto themselves
+            if (count == 0)
+                return;
+
+            if (_IsBulkRelocatable())
+            {
+                std::destroy_n(&_Elems[index], count);
+                _ShiftElements(index + count, index);
+            }
+            else
+            {
+                _RecordMoves(_Count - index - count);
+                std::move(&_Elems[index + count], &_Elems[_Count], &_Elems[index]);
+                std::destroy_n(&_Elems[_Count - count], count);
+            }
 
-            std::move(&_Elems[index + count], &_Elems[_Count], &_Elems[index]);
             _Count -= count;
         }
         else
             throw std::out_of_range("where");
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Resize(std::size_t n) noexcept requires std::default_initializable<T>
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Reserve(std::size_t capacity)
+    {
+        if (capacity > _Capacity)
+            _Reallocate(capacity);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Resize(std::size_t n) requires std::default_initializable<T>
     {
         if (n < _Count)
-            std::destroy_n(&_Elems[_Count - n], n);
+            std::destroy(&_Elems[n], &_Elems[_Count]);
+        else if (n > _Count)
+        {
+            if (n > _Capacity)
+                _Reallocate(_NextCapacity(n));
+
+            UninitializedDefaultConstruct(&_Elems[_Count], n - _Count);
+        }
 
-        _Reallocate(_Count = n);
+        _Count = n;
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Reverse() noexcept(std::is_nothrow_move_assignable_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Reverse() noexcept(std::is_nothrow_move_assignable_v<T>)
     {
         for (std::size_t i = 0; i < _Count / 2; i++)
             _Elems[i] = std::exchange(_Elems[_Count - i - 1], _Elems[i]);
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::Sort(Comparison<T> compare)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::ShrinkToFit()
+    {
+        if (_Capacity == _Count)
+            return;
+
+        if (_Count == 0)
+        {
+            _Deallocate(_Elems, _Capacity);
+            _Elems = nullptr;
+            _Capacity = 0;
+        }
+        else
+            _Reallocate(_Count);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Sort()
     {
-        Container::Sort<List<T, Allocator>>(*this, compare);
+        Sort<DefaultComparer<T>>(DefaultComparer<T>{});
     }
 
-    // List<T, Allocator> - Template Member Functions
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Sort(Comparison<T> compare)
+    {
+        Sort<Comparison<T>>(compare);
+    }
+
+    /// @brief Exchanges the contents of two lists. Unless the allocator propagates on swap, both lists must use equal allocators.
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::Swap(List<T, Allocator, Growth>& other) noexcept
+    {
+        if constexpr (_AllocTraits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(_Alloc, other._Alloc);
+        }
 
-    template <class T, class Allocator>
+        std::swap(_Capacity, other._Capacity);
+        std::swap(_Count, other._Count);
+        std::swap(_Elems, other._Elems);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T& List<T, Allocator, Growth>::UnsafeAt(std::size_t index) noexcept
+    {
+        return _Elems[index];
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr const T& List<T, Allocator, Growth>::UnsafeAt(std::size_t index) const noexcept
+    {
+        return _Elems[index];
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::UpperBound(const T& what) const
+    {
+        return UpperBound<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    // List<T, Allocator, Growth> - Template Member Functions
+
+    template <class T, class Allocator, GrowthPolicy Growth>
     template <ForwardIterableObjectOf<T> _It>
-    constexpr void List<T, Allocator>::AddRange(const _It& what) noexcept(std::is_nothrow_copy_assignable_v<T>&& std::is_nothrow_move_assignable_v<T>)
+    constexpr void List<T, Allocator, Growth>::AddRange(const _It& what) noexcept(std::is_nothrow_copy_assignable_v<T>&& std::is_nothrow_move_assignable_v<T>)
     {
         std::size_t add_count = static_cast<std::size_t>(what.end() - what.begin());
 
         if (add_count > _Capacity - _Count)
-            _Reallocate(_Count * 2 + add_count);
+            _Reallocate(_NextCapacity(_Count + add_count));
 
+        CQUE_RECORD(ListItemsCopied, add_count);
         UninitializedCopy(what.begin(), what.end(), &_Elems[_Count]);
         _Count += add_count;
     }
 
-    template <class T, class Allocator>
-    template <ForwardIterableObjectOf<T> _It>
-    constexpr void List<T, Allocator>::AddRange(_It&& what) noexcept(std::is_nothrow_move_assignable_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr void List<T, Allocator, Growth>::AddRange(_It&& what) noexcept(std::is_nothrow_move_assignable_v<T>)
     {
         std::size_t add_count = static_cast<std::size_t>(what.end() - what.begin());
 
         if (add_count > _Capacity - _Count)
-            _Reallocate(_Count * 2 + add_count);
+            _Reallocate(_NextCapacity(_Count + add_count));
 
         UninitializedMove(what.begin(), what.end(), &_Elems[_Count]);
         _Count += add_count;
     }
 
-    template <class T, class Allocator>
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t List<T, Allocator, Growth>::BinarySearch(const T& what, _Compare compare) const
+    {
+        return Container::BinarySearch<T, List<T, Allocator, Growth>, _Compare>(*this, what, compare);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
     template <class TOutput>
-    constexpr List<TOutput> List<T, Allocator>::ConvertAll(Converter<T, TOutput> converter) const
+    constexpr List<TOutput, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> List<T, Allocator, Growth>::ConvertAll(Converter<T, TOutput> converter) const
     {
-        List<TOutput> out(_Count);
+        return ConvertAll<TOutput, Converter<T, TOutput>>(converter);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <class TOutput, ConverterOf<T, TOutput> _Converter>
+    constexpr List<TOutput, typename std::allocator_traits<Allocator>::template rebind_alloc<TOutput>, Growth> List<T, Allocator, Growth>::ConvertAll(_Converter converter) const
+    {
+        using _OutputAllocator = typename _AllocTraits::template rebind_alloc<TOutput>;
+
+        List<TOutput, _OutputAllocator, Growth> out(_Count, _OutputAllocator(_AllocTraits::select_on_container_copy_construction(_Alloc)));
         for (std::size_t i = 0; i < _Count; i++)
-            out[i] = converter(_Elems[i]);
+            out.UnsafeAt(i) = std::invoke(converter, _Elems[i]);
 
         return out;
     }
 
-    template <class T, class Allocator>
+    template <class T, class Allocator, GrowthPolicy Growth>
     template <ForwardIterableObjectOf<T> _It>
-    constexpr void List<T, Allocator>::CopyTo(_It& where) const noexcept(std::is_nothrow_copy_assignable_v<T>)
+    constexpr void List<T, Allocator, Growth>::CopyTo(_It& where) const noexcept(std::is_nothrow_copy_assignable_v<T>)
     {
         std::copy(_Elems, &_Elems[_Count], where.begin());
     }
 
-    template <class T, class Allocator>
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <class... Args> requires std::constructible_from<T, Args...>
+    constexpr T& List<T, Allocator, Growth>::Emplace(Args&&... args)
+    {
+        if (_Count == _Capacity && !_TryExpand(_NextCapacity(_Count + 1)))
+            _EmplaceReallocating(_Count, std::forward<Args>(args)...);
+        else
+            std::construct_at(&_Elems[_Count], std::forward<Args>(args)...);
+
+        return _Elems[_Count++];
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <class... Args> requires std::constructible_from<T, Args...>
+    constexpr T& List<T, Allocator, Growth>::EmplaceAt(std::size_t index, Args&&... args)
+    {
+        if (index == _Count)
+            return Emplace(std::forward<Args>(args)...);
+        else if (index < _Count)
+        {
+            if (_Count == _Capacity && !_TryExpand(_NextCapacity(_Count + 1)))
+            {
+                _EmplaceReallocating(index, std::forward<Args>(args)...);
+                _Count++;
+            }
+            // Built aside first as the arguments may refer to the items about to be shifted
+            else
+                Insert(index, T(std::forward<Args>(args)...));
+
+            return _Elems[index];
+        }
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr bool List<T, Allocator, Growth>::Exists(_Predicate match) const
+    {
+        return Container::Exists<T, List<T, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr T List<T, Allocator, Growth>::Find(_Predicate match) const
+    {
+        return Container::Find<T, List<T, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr List<T, Allocator, Growth> List<T, Allocator, Growth>::FindAll(_Predicate match) const
+    {
+        List<T, Allocator, Growth> out(_AllocTraits::select_on_container_copy_construction(_Alloc));
+        for (std::size_t i = 0; i < _Count; i++)
+            if (std::invoke(match, _Elems[i]))
+                out.Add(_Elems[i]);
+
+        return out;
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t List<T, Allocator, Growth>::FindIndex(_Predicate match) const
+    {
+        return Container::FindIndex<T, List<T, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr T List<T, Allocator, Growth>::FindLast(_Predicate match) const
+    {
+        return Container::FindLast<T, List<T, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t List<T, Allocator, Growth>::FindLastIndex(_Predicate match) const
+    {
+        return Container::FindLastIndex<T, List<T, Allocator, Growth>, _Predicate>(*this, match);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
     template <ForwardIterableObjectOf<T> _It>
-    constexpr void List<T, Allocator>::InsertRange(std::size_t index, const _It& what)
+    constexpr void List<T, Allocator, Growth>::InsertRange(std::size_t index, const _It& what)
     {
         if (index == _Count)
             this->AddRange(what);
         else if (index < _Count)
         {
             std::size_t add_count = static_cast<std::size_t>(what.end() - what.begin());
+            CQUE_RECORD(ListItemsCopied, add_count);
 
             // If the number of items to be added exceeds the remaining space, allocate a new chunk of memory and move the items
             // The move is split into two parts for more efficiency: items before the place of insertion and those after
-            if (add_count > _Capacity - _Count)
+            if (add_count > _Capacity - _Count && !_TryExpand(_NextCapacity(_Count + add_count)))
             {
-                T* new_Elems = _Alloc.allocate(_Count * 2 + add_count);
+                std::size_t new_capacity = _NextCapacity(_Count + add_count);
+                T* new_Elems = _Allocate(new_capacity);
 
-                UninitializedMove(_Elems, &_Elems[index], new_Elems);
-                UninitializedMove(&_Elems[index], &_Elems[_Count], &new_Elems[index + add_count]);
                 UninitializedCopy(what.begin(), what.end(), &new_Elems[index]);
+                CQUE_RECORD(ListReallocations, 1);
+                _RecordMoves(_Count);
+                UninitializedRelocate(_Elems, &_Elems[index], new_Elems);
+                UninitializedRelocate(&_Elems[index], &_Elems[_Count], &new_Elems[index + add_count]);
 
-                _Release();
+                _Deallocate(_Elems, _Capacity);
                 _Elems = new_Elems;
-                _Capacity = _Count * 2 + add_count;
+                _Capacity = new_capacity;
             }
             // Otherwise, shift items after the place of insertion to give space for items that are to be added
+            else if (_IsBulkRelocatable())
+            {
+                _ShiftElements(index, index + add_count);
+
+                // Trivially relocatable items are either trivially copyable or opted in, hence the fill is guarded
+                try
+                {
+                    UninitializedCopy(what.begin(), what.end(), &_Elems[index]);
+                }
+                catch (...)
+                {
+                    _ShiftElements(index + add_count, index);
+                    throw;
+                }
+            }
             else
             {
+                _RecordMoves(_Count - index);
                 UninitializedDefaultConstruct(&_Elems[_Count], add_count);
                 std::move_backward(&_Elems[index], &_Elems[_Count], &_Elems[_Count + add_count]);
                 std::copy(what.begin(), what.end(), &_Elems[index]);
@@ -499,9 +973,9 @@ namespace CQue
             throw std::out_of_range("index");
     }
 
-    template <class T, class Allocator>
-    template <ForwardIterableObjectOf<T> _It>
-    constexpr void List<T, Allocator>::InsertRange(std::size_t index, _It&& what)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr void List<T, Allocator, Growth>::InsertRange(std::size_t index, _It&& what)
     {
         if (index == _Count)
             this->AddRange(std::move(what));
@@ -511,21 +985,39 @@ namespace CQue
 
             // If the number of items to be added exceeds the remaining space, allocate a new chunk of memory and move the items
             // The move is split into two parts for more efficiency: items before the place of insertion and those after
-            if (add_count > _Capacity - _Count)
+            if (add_count > _Capacity - _Count && !_TryExpand(_NextCapacity(_Count + add_count)))
             {
-                T* new_Elems = _Alloc.allocate(_Count * 2 + add_count);
+                std::size_t new_capacity = _NextCapacity(_Count + add_count);
+                T* new_Elems = _Allocate(new_capacity);
 
-                UninitializedMove(_Elems, &_Elems[index], new_Elems);
-                UninitializedMove(&_Elems[index], &_Elems[_Count], &new_Elems[index + add_count]);
-                UninitializedCopy(what.begin(), what.end(), &new_Elems[index]);
+                UninitializedMove(what.begin(), what.end(), &new_Elems[index]);
+                CQUE_RECORD(ListReallocations, 1);
+                _RecordMoves(_Count);
+                UninitializedRelocate(_Elems, &_Elems[index], new_Elems);
+                UninitializedRelocate(&_Elems[index], &_Elems[_Count], &new_Elems[index + add_count]);
 
-                _Release();
+                _Deallocate(_Elems, _Capacity);
                 _Elems = new_Elems;
-                _Capacity = _Count * 2 + add_count;
+                _Capacity = new_capacity;
             }
             // Otherwise, shift items after the place of insertion to give space for items that are to be added
+            else if (_IsBulkRelocatable())
+            {
+                _ShiftElements(index, index + add_count);
+
+                try
+                {
+                    UninitializedMove(what.begin(), what.end(), &_Elems[index]);
+                }
+                catch (...)
+                {
+                    _ShiftElements(index + add_count, index);
+                    throw;
+                }
+            }
             else
             {
+                _RecordMoves(_Count - index);
                 UninitializedDefaultConstruct(&_Elems[_Count], add_count);
                 std::move_backward(&_Elems[index], &_Elems[_Count], &_Elems[_Count + add_count]);
                 std::move(what.begin(), what.end(), &_Elems[index]);
@@ -537,68 +1029,230 @@ namespace CQue
             throw std::out_of_range("index");
     }
 
-    // List<T, Allocator> - Iterators
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t List<T, Allocator, Growth>::InsertSorted(const T& what, _Compare compare)
+    {
+        std::size_t index = UpperBound<_Compare>(what, compare);
+        Insert(index, what);
+
+        return index;
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t List<T, Allocator, Growth>::InsertSorted(T&& what, _Compare compare)
+    {
+        std::size_t index = UpperBound<_Compare>(what, compare);
+        Insert(index, std::move(what));
+
+        return index;
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t List<T, Allocator, Growth>::LowerBound(const T& what, _Compare compare) const
+    {
+        return Container::LowerBound<T, List<T, Allocator, Growth>, _Compare>(*this, what, compare);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <ForwardIterableObjectOf<T> _It, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void List<T, Allocator, Growth>::MergeSorted(const _It& other, _Compare compare)
+    {
+        auto first = other.begin(), last = other.end();
+
+        // The items of this list are moved over unless they are the very ones being merged in, which constant evaluation cannot
+        // tell by comparing addresses
+        bool aliased = std::is_constant_evaluated();
+        if constexpr (std::contiguous_iterator<decltype(first)>)
+        {
+            if (!aliased && first != last)
+            {
+                const T* other_first = std::to_address(first);
+                aliased = std::less_equal<const T*>{}(_Elems, other_first) && std::less<const T*>{}(other_first, &_Elems[_Count]);
+            }
+        }
+
+        List<T, Allocator, Growth> merged(_Alloc);
+        merged.Reserve(_Count + static_cast<std::size_t>(std::distance(first, last)));
+
+        auto take = [&](std::size_t index)
+        {
+            if (aliased)
+                merged.Emplace(std::as_const(_Elems[index]));
+            else
+                merged.Emplace(std::move(_Elems[index]));
+        };
+
+        std::size_t index = 0;
+        while (index < _Count && first != last)
+        {
+            if (std::invoke(compare, *first, std::as_const(_Elems[index])))
+                merged.Emplace(*first++);
+            else
+                take(index++);
+        }
+
+        for (; index < _Count; index++)
+            take(index);
+        for (; first != last; ++first)
+            merged.Emplace(*first);
+
+        Swap(merged);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t List<T, Allocator, Growth>::RemoveAll(_Predicate match)
+    {
+        // Items before the first match stay where they are
+        std::size_t kept = 0;
+        while (kept < _Count && !std::invoke(match, std::as_const(_Elems[kept])))
+            kept++;
+
+        // Each item kept from then on moves down once, over the gap left by the items removed so far
+        for (std::size_t i = kept + 1; i < _Count; i++)
+            if (!std::invoke(match, std::as_const(_Elems[i])))
+                _Elems[kept++] = std::move(_Elems[i]);
+
+        std::size_t removed = _Count - kept;
+        std::destroy(_Elems + kept, _Elems + _Count);
+        _Count = kept;
+
+        return removed;
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void List<T, Allocator, Growth>::Sort(_Compare compare)
+    {
+        Container::Sort<List<T, Allocator, Growth>, T, _Compare>(*this, compare);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <ThreeWayComparison<T> _Compare>
+    constexpr void List<T, Allocator, Growth>::Sort(_Compare compare)
+    {
+        Container::Sort<List<T, Allocator, Growth>, T, _Compare>(*this, compare);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t List<T, Allocator, Growth>::UpperBound(const T& what, _Compare compare) const
+    {
+        return Container::UpperBound<T, List<T, Allocator, Growth>, _Compare>(*this, what, compare);
+    }
+
+    // List<T, Allocator, Growth> - Iterators
 
-    template <class T, class Allocator>
-    constexpr T* List<T, Allocator>::begin() const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T* List<T, Allocator, Growth>::begin() const noexcept
     {
         return _Elems;
     }
 
-    template <class T, class Allocator>
-    constexpr T* List<T, Allocator>::end() const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T* List<T, Allocator, Growth>::end() const noexcept
     {
         return &_Elems[_Count];
     }
 
-    template <class T, class Allocator>
-    constexpr const T* List<T, Allocator>::cbegin() const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr const T* List<T, Allocator, Growth>::cbegin() const noexcept
     {
         return _Elems;
     }
 
-    template <class T, class Allocator>
-    constexpr const T* List<T, Allocator>::cend() const noexcept
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr const T* List<T, Allocator, Growth>::cend() const noexcept
     {
         return &_Elems[_Count];
     }
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>& List<T, Allocator>::operator=(const List<T, Allocator>& other)
+    // List<T, Allocator, Growth> - Operators
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>& List<T, Allocator, Growth>::operator=(const List<T, Allocator, Growth>& other)
     {
+        if (this == &other)
+            return *this;
+
+        if constexpr (_AllocTraits::propagate_on_container_copy_assignment::value)
+        {
+            // The memory held so far has to be given back to the allocator it came from before that allocator is replaced
+            if (!_AllocTraits::is_always_equal::value && _Alloc != other._Alloc)
+            {
+                _Release();
+                _Elems = nullptr;
+                _Capacity = _Count = 0;
+            }
+
+            _Alloc = other._Alloc;
+        }
+
+        Clear();
+
         if (_Capacity < other._Count)
         {
             _Release();
-            _Elems = _Alloc.allocate(_Capacity = other._Count);
-        }
-        else
-            std::destroy_n(_Elems, _Count);
+            _Elems = nullptr;
+            _Capacity = 0;
 
-        for (std::size_t i = 0; i < other._Count; i++)
-            std::construct_at(&_Elems[i], other._Elems[i]);
+            _Elems = _Allocate(other._Count);
+            _Capacity = other._Count;
+        }
 
+        CQUE_RECORD(ListItemsCopied, other._Count);
+        UninitializedCopy(other._Elems, &other._Elems[other._Count], _Elems);
         _Count = other._Count;
 
         return *this;
     }
 
-    // List<T, Allocator> - Operators
-
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>& List<T, Allocator>::operator=(List<T, Allocator>&& other)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>& List<T, Allocator, Growth>::operator=(List<T, Allocator, Growth>&& other)
     {
-        if (_Elems)
+        if (this == &other)
+            return *this;
+
+        if (_AllocTraits::propagate_on_container_move_assignment::value || _AllocTraits::is_always_equal::value || _Alloc == other._Alloc)
+        {
             _Release();
 
-        _Elems = std::exchange(other._Elems, nullptr);
-        _Count = std::exchange(other._Count, 0);
-        _Capacity = std::exchange(other._Capacity, 0);
+            if constexpr (_AllocTraits::propagate_on_container_move_assignment::value)
+                _Alloc = std::move(other._Alloc);
+
+            _Elems = std::exchange(other._Elems, nullptr);
+            _Count = std::exchange(other._Count, 0);
+            _Capacity = std::exchange(other._Capacity, 0);
+        }
+        else
+        {
+            // The other list's memory cannot be adopted by an unequal allocator, so the items are moved over one by one
+            Clear();
+
+            if (_Capacity < other._Count)
+            {
+                _Release();
+                _Elems = nullptr;
+                _Capacity = 0;
+
+                _Elems = _Allocate(other._Count);
+                _Capacity = other._Count;
+            }
+
+            _RecordMoves(other._Count);
+            UninitializedMove(other._Elems, &other._Elems[other._Count], _Elems);
+            _Count = other._Count;
+            other.Clear();
+        }
 
         return *this;
     }
 
-    template <class T, class Allocator>
-    constexpr T& List<T, Allocator>::operator[](std::size_t index)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T& List<T, Allocator, Growth>::operator[](std::size_t index)
     {
         if (index < _Count)
             return _Elems[index];
@@ -606,8 +1260,8 @@ namespace CQue
             throw std::out_of_range("index");
     }
 
-    template <class T, class Allocator>
-    constexpr const T& List<T, Allocator>::operator[](std::size_t index) const
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr const T& List<T, Allocator, Growth>::operator[](std::size_t index) const
     {
         if (index < _Count)
             return _Elems[index];
@@ -615,8 +1269,8 @@ namespace CQue
             throw std::out_of_range("index");
     }
 
-    template <class T, class Allocator>
-    constexpr bool List<T, Allocator>::operator==(const List<T, Allocator>& other) const noexcept(std::declval<T>() == std::declval<T>()) requires std::equality_comparable<T>
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr bool List<T, Allocator, Growth>::operator==(const List<T, Allocator, Growth>& other) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>
     {
         if (_Count != other._Count)
             return false;
@@ -631,37 +1285,139 @@ namespace CQue
         }
     }
 
-    // List<T, Allocator> - Destructor
+    // List<T, Allocator, Growth> - Destructor
 
-    template <class T, class Allocator>
-    constexpr List<T, Allocator>::~List() noexcept(std::is_nothrow_destructible_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth>::~List() noexcept(std::is_nothrow_destructible_v<T>)
     {
         _Release();
     }
 
-    // List<T, Allocator> - Protected Member Functions
+    // List<T, Allocator, Growth> - Protected Member Functions
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::_Reallocate(std::size_t new_capacity) noexcept(std::is_nothrow_move_constructible_v<T>&& std::is_nothrow_destructible_v<T>)
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr T* List<T, Allocator, Growth>::_Allocate(std::size_t n)
     {
+        CQUE_RECORD(ListAllocations, 1);
+        return _AllocTraits::allocate(_Alloc, n);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::_Deallocate(T* where, std::size_t n) noexcept
+    {
+        _AllocTraits::deallocate(_Alloc, where, n);
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr std::size_t List<T, Allocator, Growth>::_NextCapacity(std::size_t required) const noexcept
+    {
+        return Growth::NextCapacity(_Capacity, required, sizeof(T));
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::_Reallocate(std::size_t new_capacity) noexcept(std::is_nothrow_move_constructible_v<T>&& std::is_nothrow_destructible_v<T>)
+    {
+        if (new_capacity > _Capacity && _TryExpand(new_capacity))
+            return;
+
         if (_Capacity == 0)
-            _Elems = _Alloc.allocate(new_capacity);
+            _Elems = _Allocate(new_capacity);
         else if (_Capacity != new_capacity)
         {
-            T* new_Elems = _Alloc.allocate(new_capacity);
-            UninitializedMove(_Elems, &_Elems[_Count], new_Elems);
+            T* new_Elems = _Allocate(new_capacity);
 
-            _Release();
+            CQUE_RECORD(ListReallocations, 1);
+            _RecordMoves(_Count);
+            UninitializedRelocate(_Elems, &_Elems[_Count], new_Elems);
+
+            _Deallocate(_Elems, _Capacity);
             _Elems = new_Elems;
         }
 
         _Capacity = new_capacity;
     }
 
-    template <class T, class Allocator>
-    constexpr void List<T, Allocator>::_Release() noexcept(std::is_nothrow_destructible_v<T>)
+    /// @brief Counts items moved to a new block or within the block when instrumentation is enabled, and does nothing otherwise.
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::_RecordMoves([[maybe_unused]] std::size_t count) const noexcept
     {
-        std::destroy_n(_Elems, _Count);
-        _Alloc.deallocate(_Elems, _Capacity);
+        CQUE_RECORD(ListItemsMoved, count);
+        CQUE_RECORD(ListBytesMoved, count * sizeof(T));
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::_Release() noexcept(std::is_nothrow_destructible_v<T>)
+    {
+        if (_Elems)
+        {
+            std::destroy_n(_Elems, _Count);
+            _Deallocate(_Elems, _Capacity);
+        }
+    }
+
+    /// @brief Moves the items in [from, _Count) bytewise so that they start at index `to`. Only valid for trivially relocatable
+    /// items; the vacated slots are left as uninitialized storage.
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr void List<T, Allocator, Growth>::_ShiftElements(std::size_t from, std::size_t to) noexcept
+    {
+        _RecordMoves(_Count - from);
+        std::memmove(static_cast<void*>(&_Elems[to]), static_cast<const void*>(&_Elems[from]), (_Count - from) * sizeof(T));
+    }
+
+    /// @brief Grows the block in place if the allocator is able to, which leaves the items where they are.
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr bool List<T, Allocator, Growth>::_TryExpand(std::size_t new_capacity) noexcept
+    {
+        if constexpr (ExpandableAllocator<Allocator>)
+        {
+            if (!std::is_constant_evaluated() && _Elems && _Alloc.TryExpand(_Elems, _Capacity, new_capacity))
+            {
+                _Capacity = new_capacity;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief Moves the items to a block grown by the growth policy, with an item constructed from the arguments at the given
+    /// index. The item is constructed first, in case the arguments refer to items of this list. Leaves _Count to the caller.
+    template <class T, class Allocator, GrowthPolicy Growth>
+    template <class... Args>
+    constexpr void List<T, Allocator, Growth>::_EmplaceReallocating(std::size_t index, Args&&... args)
+    {
+        std::size_t new_capacity = _NextCapacity(_Count + 1);
+        T* new_Elems = _Allocate(new_capacity);
+
+        try
+        {
+            std::construct_at(&new_Elems[index], std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            _Deallocate(new_Elems, new_capacity);
+            throw;
+        }
+
+        if (_Capacity != 0)
+        {
+            CQUE_RECORD(ListReallocations, 1);
+            _RecordMoves(_Count);
+        }
+
+        UninitializedRelocate(_Elems, &_Elems[index], new_Elems);
+        UninitializedRelocate(&_Elems[index], &_Elems[_Count], &new_Elems[index + 1]);
+
+        if (_Elems)
+            _Deallocate(_Elems, _Capacity);
+
+        _Elems = new_Elems;
+        _Capacity = new_capacity;
+    }
+
+    template <class T, class Allocator, GrowthPolicy Growth>
+    constexpr bool List<T, Allocator, Growth>::_IsBulkRelocatable() noexcept
+    {
+        return is_trivially_relocatable_v<T> && !std::is_constant_evaluated();
     }
 };
\ No newline at end of file
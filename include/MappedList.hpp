@@ -0,0 +1,190 @@
+#pragma once
+
+#include "Containers.hpp"
+#include "TypeTag.hpp"
+
+namespace CQue
+{
+	// ####################################### FORWARD DECLARATIONS #######################################
+
+	/// @brief Read-only mapping of a whole file into memory. Pages are read in from the file as they are first touched, so
+	/// opening costs the same whatever the size of the file. Move-only.
+	class MappedFile
+	{
+	public:
+		MappedFile() noexcept;
+
+		/// @brief Maps the file at the given path, throwing std::system_error if it cannot be opened or mapped.
+		explicit MappedFile(const std::string& path);
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		const void* Data() const noexcept;
+		std::size_t Size() const noexcept;
+
+		~MappedFile();
+
+	private:
+		void _Unmap() noexcept;
+
+		const void* _Data;
+		std::size_t _Size;
+	};
+
+	/// @brief Layout of the start of a file written by SaveList. The items follow at DataOffset, aligned for their type, in
+	/// the byte order of the machine which wrote them.
+	struct MappedListHeader
+	{
+		/// @brief "CQueList" when read by a machine of the same byte order as the writer
+		static constexpr std::uint64_t Signature = 0x7473694c65755143ull;
+		static constexpr std::uint32_t CurrentVersion = 1;
+
+		std::uint64_t Magic;
+		std::uint32_t Version;
+		std::uint32_t ItemAlignment;
+		std::uint64_t TypeID;
+		std::uint64_t ItemSize;
+		std::uint64_t Count;
+		std::uint64_t DataOffset;
+	};
+
+	/// @brief List loaded from a file written by SaveList, by mapping the file rather than reading it. The items are used in
+	/// place, straight from the mapped pages, hence they are read-only and need to be trivially copyable. Satisfies
+	/// RandomAccessIterableObjectOf<T, _Val>, so IterWrapper and everything in CQue::Container apply. Move-only.
+	/// Files are only recognized by builds of the same compiler, as the check relies on TypeTag::GetStableID().
+	/// @tparam T Type of the items, which has to be the type they were saved as
+	template <class T>
+	class MappedList
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "MappedList needs trivially copyable items");
+
+	public:
+		// Constructors
+
+		MappedList() noexcept = default;
+
+		/// @brief Maps the file at the given path. Throws std::system_error if it cannot be mapped, or std::runtime_error if its
+		/// header does not describe a list of T, as told by the types' stable IDs, sizes, and alignments.
+		explicit MappedList(const std::string& path);
+
+		MappedList(MappedList<T>&& other) noexcept;
+
+		// Iterators
+
+		const T* begin() const noexcept;
+		const T* end() const noexcept;
+
+		// Member Functions
+
+		std::size_t Count() const noexcept;
+		const T* Data() const noexcept;
+		const MappedFile& File() const noexcept;
+
+		// Operators
+
+		MappedList<T>& operator=(MappedList<T>&& other) noexcept;
+
+		const T& operator[](std::size_t index) const;
+
+	private:
+		MappedFile _File;
+		const T* _Elems = nullptr;
+		std::size_t _Count = 0;
+	};
+
+	/// @brief Writes the items to the given file in the format MappedList<T> maps, replacing the file if it exists. Throws
+	/// std::system_error if the file cannot be written.
+	template <class T, class Allocator, GrowthPolicy Growth>
+	void SaveList(const std::string& path, const List<T, Allocator, Growth>& list);
+
+	/// @brief Writes the items of any contiguous range to the given file in the format MappedList<T> maps.
+	template <class T>
+	void SaveList(const std::string& path, const T* items, std::size_t count);
+
+	// Header validation and writing, shared by every item type
+
+	const void* _OpenMappedList(const MappedFile& file, std::uint64_t type_id, std::size_t item_size, std::size_t item_alignment, std::size_t& count);
+	void _SaveMappedList(const std::string& path, std::uint64_t type_id, std::size_t item_size, std::size_t item_alignment, const void* items, std::size_t count);
+
+	// ######################################## BODY DECLARATIONS #########################################
+
+	// ****************************************** MappedList<T> *******************************************
+
+	template <class T>
+	MappedList<T>::MappedList(const std::string& path) : _File(path)
+	{
+		_Elems = static_cast<const T*>(_OpenMappedList(_File, GetType<T>().GetStableID(), sizeof(T), alignof(T), _Count));
+	}
+
+	template <class T>
+	MappedList<T>::MappedList(MappedList<T>&& other) noexcept : _File(std::move(other._File)), _Elems(std::exchange(other._Elems, nullptr)), _Count(std::exchange(other._Count, 0)) {}
+
+	template <class T>
+	const T* MappedList<T>::begin() const noexcept
+	{
+		return _Elems;
+	}
+
+	template <class T>
+	const T* MappedList<T>::end() const noexcept
+	{
+		return _Elems + _Count;
+	}
+
+	template <class T>
+	std::size_t MappedList<T>::Count() const noexcept
+	{
+		return _Count;
+	}
+
+	template <class T>
+	const T* MappedList<T>::Data() const noexcept
+	{
+		return _Elems;
+	}
+
+	template <class T>
+	const MappedFile& MappedList<T>::File() const noexcept
+	{
+		return _File;
+	}
+
+	template <class T>
+	MappedList<T>& MappedList<T>::operator=(MappedList<T>&& other) noexcept
+	{
+		_File = std::move(other._File);
+		_Elems = std::exchange(other._Elems, nullptr);
+		_Count = std::exchange(other._Count, 0);
+
+		return *this;
+	}
+
+	template <class T>
+	const T& MappedList<T>::operator[](std::size_t index) const
+	{
+		if (index >= _Count)
+			throw std::out_of_range("index");
+
+		return _Elems[index];
+	}
+
+	// ********************************************* SaveList *********************************************
+
+	template <class T, class Allocator, GrowthPolicy Growth>
+	void SaveList(const std::string& path, const List<T, Allocator, Growth>& list)
+	{
+		SaveList(path, list.begin(), list.Count());
+	}
+
+	template <class T>
+	void SaveList(const std::string& path, const T* items, std::size_t count)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "SaveList needs trivially copyable items");
+
+		_SaveMappedList(path, GetType<T>().GetStableID(), sizeof(T), alignof(T), items, count);
+	}
+};
\ No newline at end of file
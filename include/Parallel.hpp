@@ -0,0 +1,369 @@
+#pragma once
+
+#include "Containers.hpp"
+#include "ThreadPool.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue::Parallel
+{
+    // Multi-threaded counterparts of the CQue::Container algorithms. Inputs shorter than SequentialCutoff, or running with a
+    // concurrency of 1, are handed to the sequential algorithms. Predicates and comparers are invoked from several threads at
+    // once; each task works on its own copy of the comparer.
+
+    inline constexpr std::size_t SequentialCutoff = 16384;
+
+    /// @brief Number of threads the parallel algorithms split their work for. Defaults to the hardware concurrency. The work
+    /// itself runs on ThreadPool::Default(), hence on at most as many threads as that has.
+    std::size_t Concurrency() noexcept;
+
+    /// @brief Changes the number of threads the parallel algorithms split their work for; 0 restores the default, and 1 makes
+    /// them run sequentially.
+    void SetConcurrency(std::size_t threads) noexcept;
+
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    bool Exists(const _Container& container, _Predicate match);
+
+    /// @brief Collects the matching items in their original order.
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    List<T> FindAll(const _Container& container, _Predicate match);
+
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    std::size_t FindIndex(const _Container& container, _Predicate match);
+
+    template <std::equality_comparable T, RandomAccessIterableObjectOf<T> _Container>
+    std::size_t IndexOf(const _Container& container, const T& what);
+
+    /// @brief Sorts chunks of the container concurrently, then merges them pairwise with every merge split across threads. Not
+    /// stable. Items that may throw when moved are sorted sequentially instead.
+    template <RandomAccessIterable _Container, class T = std::decay_t<decltype(*std::declval<_Container>().begin())>>
+    void Sort(_Container& container);
+
+    template <RandomAccessIterable _Container, class T = std::decay_t<decltype(*std::declval<_Container>().begin())>, std::strict_weak_order<const T&, const T&> _Compare>
+    void Sort(_Container& container, _Compare compare);
+
+    template <RandomAccessIterable _Container, class T = std::decay_t<decltype(*std::declval<_Container>().begin())>, ThreeWayComparison<T> _Compare>
+    void Sort(_Container& container, _Compare compare);
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue::Parallel
+{
+    // Searches go through blocks of this many items; the calling thread starts from the first block and thieves take the farthest
+    // ones, so that a match found early lets the blocks past it be skipped
+    inline constexpr std::size_t _SearchBlockSize = 4096;
+
+    /// @brief Calls task(i) for every i in [0, count) on ThreadPool::Default(), the calling thread included. Once a task throws,
+    /// no further tasks are started and the exception is rethrown after the running ones are done.
+    template <class _Task>
+    void _RunTasks(std::size_t count, _Task&& task)
+    {
+        if (std::min(count, Concurrency()) <= 1)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                task(i);
+
+            return;
+        }
+
+        std::atomic<bool> failed = false;
+        ThreadPool::Default().ParallelFor(0, count, 1, [&](std::size_t i)
+        {
+            if (failed.load(std::memory_order_relaxed))
+                return;
+
+            try
+            {
+                task(i);
+            }
+            catch (...)
+            {
+                failed.store(true, std::memory_order_relaxed);
+                throw;
+            }
+        });
+    }
+
+    inline void _FetchMin(std::atomic<std::size_t>& target, std::size_t value) noexcept
+    {
+        std::size_t current = target.load(std::memory_order_relaxed);
+        while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed));
+    }
+
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    bool Exists(const _Container& container, _Predicate match)
+    {
+        auto first = container.begin();
+        std::size_t count = static_cast<std::size_t>(container.end() - first);
+
+        if (count < SequentialCutoff || Concurrency() == 1)
+            return Container::Exists<T, _Container, _Predicate>(container, match);
+
+        std::atomic<bool> found = false;
+        _RunTasks((count + _SearchBlockSize - 1) / _SearchBlockSize, [&](std::size_t block)
+        {
+            if (found.load(std::memory_order_relaxed))
+                return;
+
+            for (std::size_t i = block * _SearchBlockSize, last = std::min(count, i + _SearchBlockSize); i < last; i++)
+            {
+                if (std::invoke(match, *(first + i)))
+                {
+                    found.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        });
+
+        return found.load();
+    }
+
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    List<T> FindAll(const _Container& container, _Predicate match)
+    {
+        auto first = container.begin();
+        std::size_t count = static_cast<std::size_t>(container.end() - first);
+        std::size_t nblocks = (count < SequentialCutoff) ? 1 : std::min(Concurrency() * 4, count / _SearchBlockSize);
+
+        // Every block gathers its matches on its own; concatenating the blocks in order then keeps the original order
+        List<List<T>> parts(nblocks);
+        _RunTasks(nblocks, [&](std::size_t block)
+        {
+            for (std::size_t i = count * block / nblocks, last = count * (block + 1) / nblocks; i < last; i++)
+                if (std::invoke(match, *(first + i)))
+                    parts.UnsafeAt(block).Add(*(first + i));
+        });
+
+        List<T> out = std::move(parts.UnsafeAt(0));
+        for (std::size_t block = 1; block < nblocks; block++)
+            out.AddRange(std::move(parts.UnsafeAt(block)));
+
+        return out;
+    }
+
+    template <class T, RandomAccessIterableObjectOf<T> _Container, std::predicate<const T&> _Predicate>
+    std::size_t FindIndex(const _Container& container, _Predicate match)
+    {
+        auto first = container.begin();
+        std::size_t count = static_cast<std::size_t>(container.end() - first);
+
+        if (count < SequentialCutoff || Concurrency() == 1)
+            return Container::FindIndex<T, _Container, _Predicate>(container, match);
+
+        // Any block starting past the best match so far can be skipped
+        std::atomic<std::size_t> found = (std::size_t)(-1);
+        _RunTasks((count + _SearchBlockSize - 1) / _SearchBlockSize, [&](std::size_t block)
+        {
+            std::size_t i = block * _SearchBlockSize;
+            if (i >= found.load(std::memory_order_relaxed))
+                return;
+
+            for (std::size_t last = std::min(count, i + _SearchBlockSize); i < last; i++)
+            {
+                if (std::invoke(match, *(first + i)))
+                {
+                    _FetchMin(found, i);
+                    return;
+                }
+            }
+        });
+
+        return found.load();
+    }
+
+    template <std::equality_comparable T, RandomAccessIterableObjectOf<T> _Container>
+    std::size_t IndexOf(const _Container& container, const T& what)
+    {
+        if (static_cast<std::size_t>(container.end() - container.begin()) < SequentialCutoff || Concurrency() == 1)
+            return Container::IndexOf(container, what);
+
+        if constexpr (Simd::is_vectorizable_v<T> && std::contiguous_iterator<decltype(container.begin())>)
+        {
+            const T* data = std::to_address(container.begin());
+            std::size_t count = static_cast<std::size_t>(container.end() - container.begin());
+
+            // Same block order as FindIndex, each block going through the vector kernel
+            std::atomic<std::size_t> found = (std::size_t)(-1);
+            _RunTasks((count + _SearchBlockSize - 1) / _SearchBlockSize, [&](std::size_t block)
+            {
+                std::size_t i = block * _SearchBlockSize;
+                if (i >= found.load(std::memory_order_relaxed))
+                    return;
+
+                std::size_t index = Simd::IndexOf<T>(data + i, std::min(count - i, _SearchBlockSize), what);
+                if (index != (std::size_t)(-1))
+                    _FetchMin(found, i + index);
+            });
+
+            return found.load();
+        }
+
+        auto equals = [&what](const T& x) { return x == what; };
+        return FindIndex<T, _Container, decltype(equals)>(container, equals);
+    }
+
+    // Index of the item of a that comes after the first k items when a and b are merged, a's items first on ties
+    template <std::random_access_iterator _It, class _Compare>
+    std::size_t _CoRank(std::size_t k, _It a, std::size_t na, _It b, std::size_t nb, _Compare& compare)
+    {
+        std::size_t low = (k > nb) ? k - nb : 0;
+        std::size_t high = std::min(k, na);
+
+        while (low < high)
+        {
+            std::size_t i = low + (high - low) / 2;
+            if (std::invoke(compare, *(b + (k - i - 1)), *(a + i)))
+                high = i;
+            else
+                low = i + 1;
+        }
+
+        return low;
+    }
+
+    template <std::random_access_iterator _InputIt, std::random_access_iterator _OutputIt, class _Compare>
+    void _MoveMerge(_InputIt a, _InputIt a_last, _InputIt b, _InputIt b_last, _OutputIt out, _Compare& compare)
+    {
+        while (a != a_last && b != b_last)
+        {
+            if (std::invoke(compare, *b, *a))
+                *out++ = std::ranges::iter_move(b++);
+            else
+                *out++ = std::ranges::iter_move(a++);
+        }
+
+        out = std::move(a, a_last, out);
+        std::move(b, b_last, out);
+    }
+
+    // Merges the sorted runs [bounds[2i], bounds[2i + 1]) and [bounds[2i + 1], bounds[2i + 2]) of src into dst, splitting each
+    // merge into pieces of equal output size so that every thread has a share of the work. Returns the bounds of the merged runs.
+    template <class _Compare, std::random_access_iterator _InputIt, std::random_access_iterator _OutputIt>
+    List<std::size_t> _MergeRound(_InputIt src, _OutputIt dst, const List<std::size_t>& bounds, const _Compare& compare)
+    {
+        std::size_t runs = bounds.Count() - 1;
+        std::size_t pairs = runs / 2;
+        std::size_t pieces = (Concurrency() + pairs - 1) / pairs;
+
+        List<std::size_t> merged;
+        for (std::size_t i = 0; i < runs; i += 2)
+            merged.Add(bounds.UnsafeAt(i));
+
+        merged.Add(bounds.UnsafeAt(runs));
+
+        // The split points are all found up front; merging moves items out of the source, which searches must not see
+        List<std::size_t> splits;
+        _Compare local = compare;
+        for (std::size_t pair = 0; pair < pairs; pair++)
+        {
+            std::size_t start = bounds.UnsafeAt(pair * 2), middle = bounds.UnsafeAt(pair * 2 + 1), end = bounds.UnsafeAt(pair * 2 + 2);
+            for (std::size_t piece = 0; piece <= pieces; piece++)
+                splits.Add(_CoRank((end - start) * piece / pieces, src + start, middle - start, src + middle, end - middle, local));
+        }
+
+        _RunTasks(pairs * pieces + runs % 2, [&](std::size_t task)
+        {
+            // An unpaired last run is carried over as it is
+            if (task == pairs * pieces)
+            {
+                std::move(src + bounds.UnsafeAt(runs - 1), src + bounds.UnsafeAt(runs), dst + bounds.UnsafeAt(runs - 1));
+                return;
+            }
+
+            _Compare local = compare;
+
+            std::size_t pair = task / pieces, piece = task % pieces;
+            std::size_t start = bounds.UnsafeAt(pair * 2), middle = bounds.UnsafeAt(pair * 2 + 1), end = bounds.UnsafeAt(pair * 2 + 2);
+
+            std::size_t k_first = (end - start) * piece / pieces;
+            std::size_t k_last = (end - start) * (piece + 1) / pieces;
+            std::size_t i_first = splits.UnsafeAt(pair * (pieces + 1) + piece);
+            std::size_t i_last = splits.UnsafeAt(pair * (pieces + 1) + piece + 1);
+
+            _MoveMerge(src + (start + i_first), src + (start + i_last), src + (middle + k_first - i_first), src + (middle + k_last - i_last), dst + (start + k_first), local);
+        });
+
+        return merged;
+    }
+
+    template <RandomAccessIterable _Container, class T>
+    void Sort(_Container& container)
+    {
+        Sort<_Container, T, DefaultComparer<T>>(container, DefaultComparer<T>{});
+    }
+
+    template <RandomAccessIterable _Container, class T, std::strict_weak_order<const T&, const T&> _Compare>
+    void Sort(_Container& container, _Compare compare)
+    {
+        auto first = container.begin();
+        std::size_t count = static_cast<std::size_t>(container.end() - first);
+
+        // The merge buffer is only ever left in a consistent state if moving cannot fail halfway
+        if constexpr (!std::is_nothrow_move_constructible_v<T> || !std::is_nothrow_move_assignable_v<T>)
+            Container::Sort<_Container, T, _Compare>(container, compare);
+        else
+        {
+            if (count < SequentialCutoff || Concurrency() == 1)
+            {
+                Container::Sort<_Container, T, _Compare>(container, compare);
+                return;
+            }
+
+            std::size_t nchunks = std::min(Concurrency(), count / (SequentialCutoff / 2));
+
+            List<std::size_t> bounds;
+            for (std::size_t i = 0; i <= nchunks; i++)
+                bounds.Add(count * i / nchunks);
+
+            _RunTasks(nchunks, [&](std::size_t chunk)
+            {
+                _Compare local = compare;
+                Container::_SortRange<T>(first + bounds.UnsafeAt(chunk), first + bounds.UnsafeAt(chunk + 1), local);
+            });
+
+            std::allocator<T> alloc;
+            T* buffer = alloc.allocate(count);
+
+            _RunTasks(nchunks, [&](std::size_t chunk)
+            {
+                UninitializedMove(first + bounds.UnsafeAt(chunk), first + bounds.UnsafeAt(chunk + 1), buffer + bounds.UnsafeAt(chunk));
+            });
+
+            try
+            {
+                bool in_buffer = true;
+                while (bounds.Count() > 2)
+                {
+                    bounds = in_buffer ? _MergeRound<_Compare>(buffer, first, bounds, compare) : _MergeRound<_Compare>(first, buffer, bounds, compare);
+                    in_buffer = !in_buffer;
+                }
+
+                if (in_buffer)
+                {
+                    _RunTasks(nchunks, [&](std::size_t chunk)
+                    {
+                        std::size_t start = count * chunk / nchunks, end = count * (chunk + 1) / nchunks;
+                        std::move(buffer + start, buffer + end, first + start);
+                    });
+                }
+            }
+            catch (...)
+            {
+                std::destroy_n(buffer, count);
+                alloc.deallocate(buffer, count);
+                throw;
+            }
+
+            std::destroy_n(buffer, count);
+            alloc.deallocate(buffer, count);
+        }
+    }
+
+    template <RandomAccessIterable _Container, class T, ThreeWayComparison<T> _Compare>
+    void Sort(_Container& container, _Compare compare)
+    {
+        auto less = [compare](const T& a, const T& b) -> bool { return std::invoke(compare, a, b) < 0; };
+        Sort<_Container, T, decltype(less)>(container, less);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "Containers.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue::Query
+{
+    // Every stage wraps the sink of the stage after it, so that a single loop over the source drives the whole pipeline. A sink
+    // returns false once it wants no more items, which stops the loop early.
+
+    template <ForwardIterable _Source>
+    struct _SourceStage;
+
+    template <class _Prev, class _Predicate>
+    struct _WhereStage;
+
+    template <class _Prev, class _Selector>
+    struct _SelectStage;
+
+    template <class _Prev>
+    struct _TakeStage;
+
+    template <class _Prev>
+    struct _SkipStage;
+
+    /// @brief Lazy, composable query over a container. Where, Select, Take, and Skip only describe the query; the items are
+    /// walked once, through every stage at a time, when a terminal operation (Aggregate, Count, Exists, ToList) is invoked.
+    /// The names follow .NET's LINQ. Holds a reference to the source container, which must outlive the query.
+    /// @tparam _Stage Last stage of the pipeline
+    template <class _Stage>
+    class Pipeline
+    {
+    public:
+        using value_type = typename _Stage::value_type;
+
+        // Constructors
+
+        constexpr explicit Pipeline(const _Stage& stage);
+
+        // Stages
+
+        template <std::predicate<const value_type&> _Predicate>
+        constexpr Pipeline<_WhereStage<_Stage, _Predicate>> Where(_Predicate match) const;
+
+        template <std::invocable<const value_type&> _Selector>
+        constexpr Pipeline<_SelectStage<_Stage, _Selector>> Select(_Selector selector) const;
+
+        constexpr Pipeline<_TakeStage<_Stage>> Take(std::size_t count) const;
+        constexpr Pipeline<_SkipStage<_Stage>> Skip(std::size_t count) const;
+
+        // Terminal Operations
+
+        template <class TAccumulate, std::invocable<TAccumulate, const value_type&> _Func>
+        constexpr TAccumulate Aggregate(TAccumulate seed, _Func func) const;
+
+        constexpr std::size_t Count() const;
+
+        template <std::predicate<const value_type&> _Predicate>
+        constexpr bool Exists(_Predicate match) const;
+
+        template <class Allocator = std::allocator<value_type>>
+        constexpr List<value_type, Allocator> ToList(const Allocator& alloc = Allocator()) const;
+
+    private:
+        _Stage _Last;
+    };
+
+    /// @brief Starts a query over the given container.
+    template <ForwardIterable _Source>
+    constexpr Pipeline<_SourceStage<_Source>> From(const _Source& source) noexcept;
+
+    // A query only refers to its source, which would be gone before the query runs
+    template <ForwardIterable _Source>
+    void From(const _Source&& source) = delete;
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue::Query
+{
+    // ********************************************* Stages **********************************************
+
+    template <ForwardIterable _Source>
+    struct _SourceStage
+    {
+        using value_type = std::remove_cvref_t<decltype(*std::declval<const _Source&>().begin())>;
+
+        const _Source* Source;
+
+        template <class _Sink>
+        constexpr void Run(_Sink& sink)
+        {
+            for (const auto& x : *Source)
+                if (!sink(x))
+                    return;
+        }
+    };
+
+    template <class _Prev, class _Predicate>
+    struct _WhereStage
+    {
+        using value_type = typename _Prev::value_type;
+
+        _Prev Prev;
+        _Predicate Match;
+
+        template <class _Sink>
+        constexpr void Run(_Sink& sink)
+        {
+            auto where = [&](auto&& x) { return std::invoke(Match, std::as_const(x)) ? sink(std::forward<decltype(x)>(x)) : true; };
+            Prev.Run(where);
+        }
+    };
+
+    template <class _Prev, class _Selector>
+    struct _SelectStage
+    {
+        using value_type = std::remove_cvref_t<std::invoke_result_t<_Selector&, const typename _Prev::value_type&>>;
+
+        _Prev Prev;
+        _Selector Selector;
+
+        template <class _Sink>
+        constexpr void Run(_Sink& sink)
+        {
+            auto select = [&](auto&& x) { return sink(std::invoke(Selector, std::as_const(x))); };
+            Prev.Run(select);
+        }
+    };
+
+    template <class _Prev>
+    struct _TakeStage
+    {
+        using value_type = typename _Prev::value_type;
+
+        _Prev Prev;
+        std::size_t Count;
+
+        template <class _Sink>
+        constexpr void Run(_Sink& sink)
+        {
+            // Not even the first item is pulled through the earlier stages when none is wanted
+            if (Count == 0)
+                return;
+
+            std::size_t remaining = Count;
+            auto take = [&](auto&& x) { return sink(std::forward<decltype(x)>(x)) && --remaining > 0; };
+            Prev.Run(take);
+        }
+    };
+
+    template <class _Prev>
+    struct _SkipStage
+    {
+        using value_type = typename _Prev::value_type;
+
+        _Prev Prev;
+        std::size_t Count;
+
+        template <class _Sink>
+        constexpr void Run(_Sink& sink)
+        {
+            std::size_t skipped = 0;
+            auto skip = [&](auto&& x)
+            {
+                if (skipped < Count)
+                {
+                    skipped++;
+                    return true;
+                }
+
+                return sink(std::forward<decltype(x)>(x));
+            };
+            Prev.Run(skip);
+        }
+    };
+
+    // ***************************************** Pipeline<_Stage> *****************************************
+
+#if 1
+    // Pipeline<_Stage> - Constructors
+
+    template <class _Stage>
+    constexpr Pipeline<_Stage>::Pipeline(const _Stage& stage) : _Last(stage) {}
+
+    // Pipeline<_Stage> - Stages
+
+    template <class _Stage>
+    template <std::predicate<const typename _Stage::value_type&> _Predicate>
+    constexpr Pipeline<_WhereStage<_Stage, _Predicate>> Pipeline<_Stage>::Where(_Predicate match) const
+    {
+        return Pipeline<_WhereStage<_Stage, _Predicate>>({ _Last, std::move(match) });
+    }
+
+    template <class _Stage>
+    template <std::invocable<const typename _Stage::value_type&> _Selector>
+    constexpr Pipeline<_SelectStage<_Stage, _Selector>> Pipeline<_Stage>::Select(_Selector selector) const
+    {
+        return Pipeline<_SelectStage<_Stage, _Selector>>({ _Last, std::move(selector) });
+    }
+
+    template <class _Stage>
+    constexpr Pipeline<_TakeStage<_Stage>> Pipeline<_Stage>::Take(std::size_t count) const
+    {
+        return Pipeline<_TakeStage<_Stage>>({ _Last, count });
+    }
+
+    template <class _Stage>
+    constexpr Pipeline<_SkipStage<_Stage>> Pipeline<_Stage>::Skip(std::size_t count) const
+    {
+        return Pipeline<_SkipStage<_Stage>>({ _Last, count });
+    }
+
+    // Pipeline<_Stage> - Terminal Operations
+    // Each one runs a copy of the stages, so that a query may be run any number of times with fresh state
+
+    template <class _Stage>
+    template <class TAccumulate, std::invocable<TAccumulate, const typename _Stage::value_type&> _Func>
+    constexpr TAccumulate Pipeline<_Stage>::Aggregate(TAccumulate seed, _Func func) const
+    {
+        _Stage stages = _Last;
+        auto aggregate = [&](auto&& x)
+        {
+            seed = std::invoke(func, std::move(seed), std::as_const(x));
+            return true;
+        };
+        stages.Run(aggregate);
+
+        return seed;
+    }
+
+    template <class _Stage>
+    constexpr std::size_t Pipeline<_Stage>::Count() const
+    {
+        _Stage stages = _Last;
+        std::size_t count = 0;
+        auto counter = [&count](auto&&)
+        {
+            count++;
+            return true;
+        };
+        stages.Run(counter);
+
+        return count;
+    }
+
+    template <class _Stage>
+    template <std::predicate<const typename _Stage::value_type&> _Predicate>
+    constexpr bool Pipeline<_Stage>::Exists(_Predicate match) const
+    {
+        _Stage stages = _Last;
+        bool found = false;
+        auto exists = [&](auto&& x) { return !(found = std::invoke(match, std::as_const(x))); };
+        stages.Run(exists);
+
+        return found;
+    }
+
+    template <class _Stage>
+    template <class Allocator>
+    constexpr List<typename _Stage::value_type, Allocator> Pipeline<_Stage>::ToList(const Allocator& alloc) const
+    {
+        _Stage stages = _Last;
+        List<value_type, Allocator> out(alloc);
+        auto add = [&out](auto&& x)
+        {
+            out.Add(std::forward<decltype(x)>(x));
+            return true;
+        };
+        stages.Run(add);
+
+        return out;
+    }
+#endif
+
+    template <ForwardIterable _Source>
+    constexpr Pipeline<_SourceStage<_Source>> From(const _Source& source) noexcept
+    {
+        return Pipeline<_SourceStage<_Source>>({ &source });
+    }
+};
\ No newline at end of file
@@ -0,0 +1,257 @@
+#pragma once
+
+#include "Containers.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief Fixed-capacity queue between exactly one producer thread and one consumer thread. Every operation is wait-free:
+    /// it finishes in a bounded number of steps whatever the other thread does, and a full or empty buffer is reported rather
+    /// than waited on. The producer's and the consumer's positions sit on cache lines of their own, each next to a cached copy
+    /// of the other's position, so that the two threads only exchange cache lines when the cached copy runs out. The items are
+    /// held inside the object. Neither copyable nor movable.
+    /// @tparam T Type of the items
+    /// @tparam N Capacity; a power of 2 turns the wrap-around into a mask
+    template <class T, std::size_t N>
+    class RingBuffer
+    {
+        static_assert(N > 0, "RingBuffer needs room for at least one item");
+
+    public:
+        // Constructors
+
+        RingBuffer() noexcept = default;
+        RingBuffer(const RingBuffer&) = delete;
+
+        // Producer Member Functions
+
+        /// @brief Copies as many of the items as fit, in order, and returns how many. They all become visible at once.
+        std::size_t EnqueueRange(const T* items, std::size_t count);
+
+        /// @brief Adds the item unless the buffer is full, and tells whether it did.
+        bool TryEnqueue(const T& what);
+        bool TryEnqueue(T&& what);
+
+        template <class... Args>
+        bool TryEmplace(Args&&... args);
+
+        // Consumer Member Functions
+
+        /// @brief Removes every item.
+        void Clear() noexcept;
+
+        /// @brief Moves up to `count` items into `out`, in order, and returns how many.
+        std::size_t DequeueRange(T* out, std::size_t count);
+
+        /// @brief Moves the oldest item into `out` and returns true, or returns false if the buffer is empty.
+        bool TryDequeue(T& out);
+
+        // Member Functions
+
+        static constexpr std::size_t Capacity() noexcept;
+
+        /// @brief Number of items, exact unless the other thread is busy with the buffer meanwhile.
+        std::size_t Count() const noexcept;
+
+        bool IsEmpty() const noexcept;
+
+        // Operators
+
+        RingBuffer& operator=(const RingBuffer&) = delete;
+
+        // Destructor
+
+        ~RingBuffer();
+
+    private:
+        T* _Slot(std::uint64_t position) noexcept;
+
+        // Positions count every item ever added or removed; being 64-bit, they do not wrap around in practice
+
+        alignas(CacheLineSize) std::atomic<std::uint64_t> _Head = 0;
+        std::uint64_t _CachedTail = 0;
+
+        alignas(CacheLineSize) std::atomic<std::uint64_t> _Tail = 0;
+        std::uint64_t _CachedHead = 0;
+
+        alignas(CacheLineSize) alignas(T) unsigned char _Items[N * sizeof(T)];
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ***************************************** RingBuffer<T, N> *****************************************
+
+#if 1
+    // RingBuffer<T, N> - Producer Member Functions
+
+    template <class T, std::size_t N>
+    std::size_t RingBuffer<T, N>::EnqueueRange(const T* items, std::size_t count)
+    {
+        const std::uint64_t tail = _Tail.load(std::memory_order_relaxed);
+
+        if (count > N - (tail - _CachedHead))
+            _CachedHead = _Head.load(std::memory_order_acquire);
+
+        count = std::min<std::size_t>(count, static_cast<std::size_t>(N - (tail - _CachedHead)));
+
+        std::size_t i = 0;
+        try
+        {
+            for (; i < count; i++)
+                std::construct_at(_Slot(tail + i), items[i]);
+        }
+        catch (...)
+        {
+            while (i-- > 0)
+                std::destroy_at(_Slot(tail + i));
+
+            throw;
+        }
+
+        _Tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    template <class T, std::size_t N>
+    bool RingBuffer<T, N>::TryEnqueue(const T& what)
+    {
+        return TryEmplace(what);
+    }
+
+    template <class T, std::size_t N>
+    bool RingBuffer<T, N>::TryEnqueue(T&& what)
+    {
+        return TryEmplace(std::move(what));
+    }
+
+    template <class T, std::size_t N>
+    template <class... Args>
+    bool RingBuffer<T, N>::TryEmplace(Args&&... args)
+    {
+        const std::uint64_t tail = _Tail.load(std::memory_order_relaxed);
+
+        // The consumer's position is only read again once the cached one says the buffer is full
+        if (tail - _CachedHead == N)
+        {
+            _CachedHead = _Head.load(std::memory_order_acquire);
+            if (tail - _CachedHead == N)
+                return false;
+        }
+
+        std::construct_at(_Slot(tail), std::forward<Args>(args)...);
+        _Tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // RingBuffer<T, N> - Consumer Member Functions
+
+    template <class T, std::size_t N>
+    void RingBuffer<T, N>::Clear() noexcept
+    {
+        const std::uint64_t head = _Head.load(std::memory_order_relaxed);
+        const std::uint64_t tail = _Tail.load(std::memory_order_acquire);
+
+        for (std::uint64_t i = head; i != tail; i++)
+            std::destroy_at(_Slot(i));
+
+        _CachedTail = tail;
+        _Head.store(tail, std::memory_order_release);
+    }
+
+    template <class T, std::size_t N>
+    std::size_t RingBuffer<T, N>::DequeueRange(T* out, std::size_t count)
+    {
+        const std::uint64_t head = _Head.load(std::memory_order_relaxed);
+
+        if (_CachedTail - head < count)
+            _CachedTail = _Tail.load(std::memory_order_acquire);
+
+        count = std::min<std::size_t>(count, static_cast<std::size_t>(_CachedTail - head));
+
+        std::size_t i = 0;
+        try
+        {
+            for (; i < count; i++)
+            {
+                T* slot = _Slot(head + i);
+                out[i] = std::move(*slot);
+                std::destroy_at(slot);
+            }
+        }
+        catch (...)
+        {
+            // The items moved out so far stay removed; the one which failed to move stays in the buffer
+            _Head.store(head + i, std::memory_order_release);
+            throw;
+        }
+
+        _Head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    template <class T, std::size_t N>
+    bool RingBuffer<T, N>::TryDequeue(T& out)
+    {
+        const std::uint64_t head = _Head.load(std::memory_order_relaxed);
+
+        if (head == _CachedTail)
+        {
+            _CachedTail = _Tail.load(std::memory_order_acquire);
+            if (head == _CachedTail)
+                return false;
+        }
+
+        T* slot = _Slot(head);
+        out = std::move(*slot);
+        std::destroy_at(slot);
+
+        _Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // RingBuffer<T, N> - Member Functions
+
+    template <class T, std::size_t N>
+    constexpr std::size_t RingBuffer<T, N>::Capacity() noexcept
+    {
+        return N;
+    }
+
+    template <class T, std::size_t N>
+    std::size_t RingBuffer<T, N>::Count() const noexcept
+    {
+        const std::uint64_t head = _Head.load(std::memory_order_acquire);
+        const std::uint64_t tail = _Tail.load(std::memory_order_acquire);
+
+        // The head may move past the tail read before it, and the tail may be ahead of the head read before it by more than N
+        return (tail > head) ? static_cast<std::size_t>(std::min<std::uint64_t>(tail - head, N)) : 0;
+    }
+
+    template <class T, std::size_t N>
+    bool RingBuffer<T, N>::IsEmpty() const noexcept
+    {
+        return (Count() == 0);
+    }
+
+    // RingBuffer<T, N> - Destructor
+
+    template <class T, std::size_t N>
+    RingBuffer<T, N>::~RingBuffer()
+    {
+        Clear();
+    }
+
+    // RingBuffer<T, N> - Private Member Functions
+
+    template <class T, std::size_t N>
+    T* RingBuffer<T, N>::_Slot(std::uint64_t position) noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(_Items) + static_cast<std::size_t>(position % N));
+    }
+#endif
+};
\ No newline at end of file
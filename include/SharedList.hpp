@@ -0,0 +1,429 @@
+#pragma once
+
+#include "Containers.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief List whose copies share one reference-counted buffer until one of them is modified, so that passing a large,
+    /// mostly read list by value costs a counter increment rather than a copy of every item. The first mutating call on a
+    /// list whose buffer is shared copies the items into a buffer of its own; a list holding the only reference modifies its
+    /// buffer in place. The count is atomic, hence copies sharing a buffer may be read, modified, and destroyed on different
+    /// threads, as with std::shared_ptr; a single SharedList object is not synchronized.
+    /// @tparam T Type of the items
+    template <class T, class Allocator = std::allocator<T>>
+    class SharedList
+    {
+    public:
+        // Constructors
+
+        SharedList() noexcept(std::is_nothrow_default_constructible_v<Allocator>);
+        explicit SharedList(const Allocator& alloc) noexcept;
+        SharedList(const SharedList<T, Allocator>& other) noexcept;
+        SharedList(SharedList<T, Allocator>&& other) noexcept;
+
+        /// @brief Takes over or copies the items of the list into a buffer of their own.
+        explicit SharedList(List<T, Allocator>&& items);
+        explicit SharedList(const List<T, Allocator>& items);
+
+        SharedList(std::initializer_list<T> lst, const Allocator& alloc = Allocator());
+
+        // Non-Template Member Functions
+
+        void Add(const T& what);
+        void Add(T&& what);
+        void Clear() noexcept;
+        bool Contains(const T& what) const requires std::equality_comparable<T>;
+        std::size_t Count() const noexcept;
+        Allocator GetAllocator() const noexcept;
+        std::size_t IndexOf(const T& what) const noexcept;
+        void Insert(std::size_t index, const T& what);
+        void Insert(std::size_t index, T&& what);
+
+        /// @brief Whether other lists share the buffer, so that the next modification copies it. Only a hint when other
+        /// threads hold copies.
+        bool IsShared() const noexcept;
+
+        /// @brief Read-only view of the items, through which every const member of List applies.
+        const List<T, Allocator>& Items() const noexcept;
+
+        /// @brief The items, unshared first, for modifications not provided here. Once this list has been copied, writes through
+        /// the reference show in the copies as well, hence it should be asked for again after every copy.
+        List<T, Allocator>& Mutable();
+
+        bool Remove(const T& what);
+        void RemoveAt(std::size_t index);
+        void Reserve(std::size_t capacity);
+        void Sort();
+
+        /// @brief Number of lists sharing the buffer, this one included, or 0 if there is no buffer yet.
+        std::size_t UseCount() const noexcept;
+
+        // Template Member Functions
+
+        template <class... Args> requires std::constructible_from<T, Args...>
+        T& Emplace(Args&&... args);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        void Sort(_Compare compare);
+
+        // Iterators
+
+        const T* begin() const noexcept;
+        const T* end() const noexcept;
+        const T* cbegin() const noexcept;
+        const T* cend() const noexcept;
+
+        // Operators
+
+        SharedList<T, Allocator>& operator=(const SharedList<T, Allocator>& other) noexcept;
+        SharedList<T, Allocator>& operator=(SharedList<T, Allocator>&& other) noexcept;
+
+        /// @brief Unshares the buffer and returns the item. As with Mutable, the reference is not to be written through once
+        /// this list has been copied.
+        T& operator[](std::size_t index);
+        const T& operator[](std::size_t index) const;
+
+        // Destructor
+
+        ~SharedList();
+
+    private:
+        struct _Buffer
+        {
+            std::atomic<std::size_t> References;
+            List<T, Allocator> Items;
+        };
+
+        using _BufferAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<_Buffer>;
+        using _BufferTraits = std::allocator_traits<_BufferAllocator>;
+
+        _Buffer* _Create(List<T, Allocator>&& items);
+        List<T, Allocator>& _Detach();
+        void _Release() noexcept;
+
+        CQUE_NO_UNIQUE_ADDRESS Allocator _Alloc;
+
+        // Null until the first item is added, so that empty lists never allocate
+        _Buffer* _Data;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ************************************* SharedList<T, Allocator> *************************************
+
+#if 1
+    // SharedList<T, Allocator> - Constructors
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::SharedList() noexcept(std::is_nothrow_default_constructible_v<Allocator>) : _Alloc(), _Data(nullptr) {}
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::SharedList(const Allocator& alloc) noexcept : _Alloc(alloc), _Data(nullptr) {}
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::SharedList(const SharedList<T, Allocator>& other) noexcept : _Alloc(other._Alloc), _Data(other._Data)
+    {
+        // A new reference is made from an existing one, hence nothing needs to be ordered before it
+        if (_Data)
+            _Data->References.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::SharedList(SharedList<T, Allocator>&& other) noexcept : _Alloc(other._Alloc), _Data(std::exchange(other._Data, nullptr)) {}
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::SharedList(List<T, Allocator>&& items) : _Alloc(items.GetAllocator()), _Data(nullptr)
+    {
+        _Data = _Create(std::move(items));
+    }
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::SharedList(const List<T, Allocator>& items) : _Alloc(items.GetAllocator()), _Data(nullptr)
+    {
+        _Data = _Create(List<T, Allocator>(items));
+    }
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::SharedList(std::initializer_list<T> lst, const Allocator& alloc) : _Alloc(alloc), _Data(nullptr)
+    {
+        _Data = _Create(List<T, Allocator>(lst, alloc));
+    }
+
+    // SharedList<T, Allocator> - Non-Template Member Functions
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::Add(const T& what)
+    {
+        // The item may belong to the shared buffer, which the other holders may free as soon as this list lets go of it
+        T copy(what);
+        _Detach().Add(std::move(copy));
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::Add(T&& what)
+    {
+        _Detach().Add(std::move(what));
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::Clear() noexcept
+    {
+        // Dropping a shared buffer is cheaper than copying it only to clear the copy
+        if (IsShared())
+            _Release();
+        else if (_Data)
+            _Data->Items.Clear();
+    }
+
+    template <class T, class Allocator>
+    bool SharedList<T, Allocator>::Contains(const T& what) const requires std::equality_comparable<T>
+    {
+        return _Data && _Data->Items.Contains(what);
+    }
+
+    template <class T, class Allocator>
+    std::size_t SharedList<T, Allocator>::Count() const noexcept
+    {
+        return _Data ? _Data->Items.Count() : 0;
+    }
+
+    template <class T, class Allocator>
+    Allocator SharedList<T, Allocator>::GetAllocator() const noexcept
+    {
+        return _Alloc;
+    }
+
+    template <class T, class Allocator>
+    std::size_t SharedList<T, Allocator>::IndexOf(const T& what) const noexcept
+    {
+        return _Data ? _Data->Items.IndexOf(what) : (std::size_t)(-1);
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::Insert(std::size_t index, const T& what)
+    {
+        T copy(what);
+        _Detach().Insert(index, std::move(copy));
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::Insert(std::size_t index, T&& what)
+    {
+        _Detach().Insert(index, std::move(what));
+    }
+
+    template <class T, class Allocator>
+    bool SharedList<T, Allocator>::IsShared() const noexcept
+    {
+        return (UseCount() > 1);
+    }
+
+    template <class T, class Allocator>
+    const List<T, Allocator>& SharedList<T, Allocator>::Items() const noexcept
+    {
+        static const List<T, Allocator> empty;
+        return _Data ? _Data->Items : empty;
+    }
+
+    template <class T, class Allocator>
+    List<T, Allocator>& SharedList<T, Allocator>::Mutable()
+    {
+        return _Detach();
+    }
+
+    template <class T, class Allocator>
+    bool SharedList<T, Allocator>::Remove(const T& what)
+    {
+        // Nothing to unshare if the item is not there
+        std::size_t index = IndexOf(what);
+        if (index == (std::size_t)(-1))
+            return false;
+
+        _Detach().RemoveAt(index);
+        return true;
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::RemoveAt(std::size_t index)
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        _Detach().RemoveAt(index);
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::Reserve(std::size_t capacity)
+    {
+        _Detach().Reserve(capacity);
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::Sort()
+    {
+        _Detach().Sort();
+    }
+
+    template <class T, class Allocator>
+    std::size_t SharedList<T, Allocator>::UseCount() const noexcept
+    {
+        return _Data ? _Data->References.load(std::memory_order_acquire) : 0;
+    }
+
+    // SharedList<T, Allocator> - Template Member Functions
+
+    template <class T, class Allocator>
+    template <class... Args> requires std::constructible_from<T, Args...>
+    T& SharedList<T, Allocator>::Emplace(Args&&... args)
+    {
+        T item(std::forward<Args>(args)...);
+        return _Detach().Emplace(std::move(item));
+    }
+
+    template <class T, class Allocator>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    void SharedList<T, Allocator>::Sort(_Compare compare)
+    {
+        _Detach().Sort(compare);
+    }
+
+    // SharedList<T, Allocator> - Iterators
+
+    template <class T, class Allocator>
+    const T* SharedList<T, Allocator>::begin() const noexcept
+    {
+        return _Data ? _Data->Items.cbegin() : nullptr;
+    }
+
+    template <class T, class Allocator>
+    const T* SharedList<T, Allocator>::end() const noexcept
+    {
+        return _Data ? _Data->Items.cend() : nullptr;
+    }
+
+    template <class T, class Allocator>
+    const T* SharedList<T, Allocator>::cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    template <class T, class Allocator>
+    const T* SharedList<T, Allocator>::cend() const noexcept
+    {
+        return end();
+    }
+
+    // SharedList<T, Allocator> - Operators
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>& SharedList<T, Allocator>::operator=(const SharedList<T, Allocator>& other) noexcept
+    {
+        if (_Data != other._Data)
+        {
+            if (other._Data)
+                other._Data->References.fetch_add(1, std::memory_order_relaxed);
+
+            _Release();
+            _Data = other._Data;
+        }
+
+        _Alloc = other._Alloc;
+        return *this;
+    }
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>& SharedList<T, Allocator>::operator=(SharedList<T, Allocator>&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _Release();
+            _Data = std::exchange(other._Data, nullptr);
+            _Alloc = other._Alloc;
+        }
+
+        return *this;
+    }
+
+    template <class T, class Allocator>
+    T& SharedList<T, Allocator>::operator[](std::size_t index)
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        return _Detach().UnsafeAt(index);
+    }
+
+    template <class T, class Allocator>
+    const T& SharedList<T, Allocator>::operator[](std::size_t index) const
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        return _Data->Items.UnsafeAt(index);
+    }
+
+    // SharedList<T, Allocator> - Destructor
+
+    template <class T, class Allocator>
+    SharedList<T, Allocator>::~SharedList()
+    {
+        _Release();
+    }
+
+    // SharedList<T, Allocator> - Private Member Functions
+
+    template <class T, class Allocator>
+    typename SharedList<T, Allocator>::_Buffer* SharedList<T, Allocator>::_Create(List<T, Allocator>&& items)
+    {
+        _BufferAllocator alloc(_Alloc);
+        _Buffer* buffer = _BufferTraits::allocate(alloc, 1);
+
+        try
+        {
+            _BufferTraits::construct(alloc, buffer, 1, std::move(items));
+        }
+        catch (...)
+        {
+            _BufferTraits::deallocate(alloc, buffer, 1);
+            throw;
+        }
+
+        return buffer;
+    }
+
+    template <class T, class Allocator>
+    List<T, Allocator>& SharedList<T, Allocator>::_Detach()
+    {
+        if (!_Data)
+            _Data = _Create(List<T, Allocator>(_Alloc));
+        else if (_Data->References.load(std::memory_order_acquire) > 1)
+        {
+            // The copy is made before letting go of the shared buffer, so that a failure leaves the list as it was
+            _Buffer* copy = _Create(List<T, Allocator>(_Data->Items, _Alloc));
+            _Release();
+            _Data = copy;
+        }
+
+        return _Data->Items;
+    }
+
+    template <class T, class Allocator>
+    void SharedList<T, Allocator>::_Release() noexcept
+    {
+        _Buffer* buffer = std::exchange(_Data, nullptr);
+
+        // The last reference to go has to see every change the other holders made before letting go
+        if (buffer && buffer->References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            _BufferAllocator alloc(buffer->Items.GetAllocator());
+            _BufferTraits::destroy(alloc, buffer);
+            _BufferTraits::deallocate(alloc, buffer, 1);
+        }
+    }
+#endif
+};
\ No newline at end of file
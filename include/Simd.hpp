@@ -0,0 +1,59 @@
+#pragma once
+
+#include "base_include.hpp"
+
+namespace CQue::Simd
+{
+	// ####################################### FORWARD DECLARATIONS #######################################
+
+	/// @brief Whether IndexOf and LastIndexOf have vectorized kernels for T, namely integers of 1, 2, 4, or 8 bytes, float, and double.
+	template <class T>
+	inline constexpr bool is_vectorizable_v = (std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) ||
+		std::is_same_v<std::remove_cv_t<T>, float> || std::is_same_v<std::remove_cv_t<T>, double>;
+
+	/// @brief Name of the instruction set picked at runtime: "AVX2", "SSE2", "NEON", or "Scalar".
+	std::string_view InstructionSet() noexcept;
+
+	/// @brief Index of the first item equal to value in [data, data + count), or (std::size_t)(-1). Items compare as with
+	/// operator==, hence NaN is never found and -0.0 matches 0.0.
+	template <class T> requires is_vectorizable_v<T>
+	std::size_t IndexOf(const T* data, std::size_t count, const T& value) noexcept;
+
+	/// @brief Index of the last item equal to value in [data, data + count), or (std::size_t)(-1).
+	template <class T> requires is_vectorizable_v<T>
+	std::size_t LastIndexOf(const T* data, std::size_t count, const T& value) noexcept;
+
+	// Entry points of the kernels; integers are searched by their bits, hence only their size matters
+
+	std::size_t _IndexOf(const std::uint8_t* data, std::size_t count, std::uint8_t value) noexcept;
+	std::size_t _IndexOf(const std::uint16_t* data, std::size_t count, std::uint16_t value) noexcept;
+	std::size_t _IndexOf(const std::uint32_t* data, std::size_t count, std::uint32_t value) noexcept;
+	std::size_t _IndexOf(const std::uint64_t* data, std::size_t count, std::uint64_t value) noexcept;
+	std::size_t _IndexOf(const float* data, std::size_t count, float value) noexcept;
+	std::size_t _IndexOf(const double* data, std::size_t count, double value) noexcept;
+
+	std::size_t _LastIndexOf(const std::uint8_t* data, std::size_t count, std::uint8_t value) noexcept;
+	std::size_t _LastIndexOf(const std::uint16_t* data, std::size_t count, std::uint16_t value) noexcept;
+	std::size_t _LastIndexOf(const std::uint32_t* data, std::size_t count, std::uint32_t value) noexcept;
+	std::size_t _LastIndexOf(const std::uint64_t* data, std::size_t count, std::uint64_t value) noexcept;
+	std::size_t _LastIndexOf(const float* data, std::size_t count, float value) noexcept;
+	std::size_t _LastIndexOf(const double* data, std::size_t count, double value) noexcept;
+
+	template <class T>
+	using _KernelType = std::conditional_t<std::is_floating_point_v<T>, std::remove_cv_t<T>,
+		std::conditional_t<sizeof(T) == 1, std::uint8_t, std::conditional_t<sizeof(T) == 2, std::uint16_t, std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>>;
+
+	// ######################################## BODY DECLARATIONS #########################################
+
+	template <class T> requires is_vectorizable_v<T>
+	std::size_t IndexOf(const T* data, std::size_t count, const T& value) noexcept
+	{
+		return _IndexOf(reinterpret_cast<const _KernelType<T>*>(data), count, std::bit_cast<_KernelType<T>>(value));
+	}
+
+	template <class T> requires is_vectorizable_v<T>
+	std::size_t LastIndexOf(const T* data, std::size_t count, const T& value) noexcept
+	{
+		return _LastIndexOf(reinterpret_cast<const _KernelType<T>*>(data), count, std::bit_cast<_KernelType<T>>(value));
+	}
+};
\ No newline at end of file
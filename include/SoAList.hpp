@@ -0,0 +1,431 @@
+#pragma once
+
+#include "Containers.hpp"
+
+#include <span>
+#include <tuple>
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    template <class _Owner>
+    class _SoARow;
+
+    template <class _Owner>
+    class _SoAIterator;
+
+    /// @brief List of rows whose fields are each kept in a column of their own, a List of that field (structure of arrays).
+    /// A scan over one field reads only that field's column, densely and in a form compilers vectorize, instead of striding
+    /// over whole rows. Iterating yields row proxies whose Get<I>() refers to field I of the row; the iterators satisfy
+    /// std::random_access_iterator with std::tuple<Fields...> as the value type, e.g. for the standard algorithms that do not
+    /// swap through the proxies. Column<I>() views field I as a std::span. Sort<I> and FindAll<I> look at one column only and
+    /// then permute or gather the other columns to match. Any change in the number of rows may invalidate spans and iterators.
+    /// @tparam Fields Types of the fields of a row
+    template <class... Fields>
+    class SoAList
+    {
+        static_assert(sizeof...(Fields) > 0, "SoAList needs at least one field");
+
+    public:
+        template <std::size_t I>
+        using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+        using value_type = std::tuple<Fields...>;
+        using RowRef = _SoARow<SoAList<Fields...>>;
+        using ConstRowRef = _SoARow<const SoAList<Fields...>>;
+        using iterator = _SoAIterator<SoAList<Fields...>>;
+        using const_iterator = _SoAIterator<const SoAList<Fields...>>;
+
+        // Constructors
+
+        constexpr SoAList() noexcept = default;
+
+        // Non-Template Member Functions
+
+        /// @brief Appends a row. Should constructing a field throw, the fields already appended are removed again.
+        constexpr void Add(const Fields&... values);
+        constexpr void Add(Fields&&... values);
+
+        constexpr void Clear() noexcept;
+        constexpr std::size_t Count() const noexcept;
+        constexpr void RemoveAt(std::size_t index);
+        constexpr void Reserve(std::size_t capacity);
+        constexpr void Swap(SoAList<Fields...>& other) noexcept;
+
+        // Template Member Functions
+
+        template <std::size_t I>
+        constexpr std::span<FieldType<I>> Column() noexcept;
+
+        template <std::size_t I>
+        constexpr std::span<const FieldType<I>> Column() const noexcept;
+
+        /// @brief Rows whose field I satisfies the predicate, in order. Only column I is read to find them.
+        template <std::size_t I, std::predicate<const std::tuple_element_t<I, std::tuple<Fields...>>&> _Predicate>
+        constexpr SoAList<Fields...> FindAll(_Predicate match) const;
+
+        template <std::size_t I, std::predicate<const std::tuple_element_t<I, std::tuple<Fields...>>&> _Predicate>
+        constexpr std::size_t FindIndex(_Predicate match) const;
+
+        /// @brief Sorts the rows by field I: the order is worked out on column I alone and then applied to every column.
+        template <std::size_t I>
+        constexpr void Sort();
+
+        template <std::size_t I, std::strict_weak_order<const std::tuple_element_t<I, std::tuple<Fields...>>&, const std::tuple_element_t<I, std::tuple<Fields...>>&> _Compare>
+        constexpr void Sort(_Compare compare);
+
+        // Iterators
+
+        constexpr iterator begin() noexcept;
+        constexpr const_iterator begin() const noexcept;
+        constexpr iterator end() noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        // Operators
+
+        constexpr RowRef operator[](std::size_t index);
+        constexpr ConstRowRef operator[](std::size_t index) const;
+
+    private:
+        template <std::size_t... Is, class... Args>
+        constexpr void _Add(std::index_sequence<Is...>, Args&&... values);
+
+        template <std::size_t... Is>
+        constexpr SoAList<Fields...> _Gather(std::index_sequence<Is...>, const List<std::size_t>& rows) const;
+
+        template <std::size_t... Is>
+        constexpr void _Permute(std::index_sequence<Is...>, const List<std::size_t>& order);
+
+        std::tuple<List<Fields>...> _Columns;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ***************************************** _SoARow<_Owner> ******************************************
+
+    /// @brief Proxy for one row of a SoAList, const if _Owner is. Assigning to it assigns to the fields of the row it refers to.
+    template <class _Owner>
+    class _SoARow
+    {
+    public:
+        using value_type = typename _Owner::value_type;
+
+        constexpr _SoARow(_Owner* owner, std::size_t index) noexcept : _List(owner), _Index(index) {}
+        constexpr _SoARow(const _SoARow& other) noexcept = default;
+
+        template <std::size_t I>
+        constexpr auto& Get() const noexcept { return _List->template Column<I>()[_Index]; }
+
+        constexpr operator value_type() const
+        {
+            return _Copy(std::make_index_sequence<std::tuple_size_v<value_type>>());
+        }
+
+        constexpr const _SoARow& operator=(const _SoARow& other) const
+        {
+            _Assign(other, std::make_index_sequence<std::tuple_size_v<value_type>>());
+            return *this;
+        }
+
+        constexpr const _SoARow& operator=(const value_type& row) const
+        {
+            _Assign(row, std::make_index_sequence<std::tuple_size_v<value_type>>());
+            return *this;
+        }
+
+    private:
+        template <std::size_t... Is>
+        constexpr value_type _Copy(std::index_sequence<Is...>) const
+        {
+            return value_type(Get<Is>()...);
+        }
+
+        template <std::size_t... Is>
+        constexpr void _Assign(const _SoARow& other, std::index_sequence<Is...>) const
+        {
+            ((Get<Is>() = other.template Get<Is>()), ...);
+        }
+
+        template <std::size_t... Is>
+        constexpr void _Assign(const value_type& row, std::index_sequence<Is...>) const
+        {
+            ((Get<Is>() = std::get<Is>(row)), ...);
+        }
+
+        _Owner* _List;
+        std::size_t _Index;
+    };
+
+    // *************************************** _SoAIterator<_Owner> ***************************************
+
+    template <class _Owner>
+    class _SoAIterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename _Owner::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = _SoARow<_Owner>;
+
+        constexpr _SoAIterator() noexcept = default;
+        constexpr _SoAIterator(_Owner* owner, std::size_t index) noexcept : _List(owner), _Index(static_cast<std::ptrdiff_t>(index)) {}
+
+        constexpr reference operator*() const noexcept { return reference(_List, static_cast<std::size_t>(_Index)); }
+        constexpr reference operator[](difference_type n) const noexcept { return reference(_List, static_cast<std::size_t>(_Index + n)); }
+
+        constexpr _SoAIterator& operator++() noexcept { ++_Index; return *this; }
+        constexpr _SoAIterator operator++(int) noexcept { _SoAIterator previous = *this; ++_Index; return previous; }
+        constexpr _SoAIterator& operator--() noexcept { --_Index; return *this; }
+        constexpr _SoAIterator operator--(int) noexcept { _SoAIterator previous = *this; --_Index; return previous; }
+
+        constexpr _SoAIterator& operator+=(difference_type n) noexcept { _Index += n; return *this; }
+        constexpr _SoAIterator& operator-=(difference_type n) noexcept { _Index -= n; return *this; }
+
+        constexpr friend _SoAIterator operator+(_SoAIterator it, difference_type n) noexcept { return it += n; }
+        constexpr friend _SoAIterator operator+(difference_type n, _SoAIterator it) noexcept { return it += n; }
+        constexpr friend _SoAIterator operator-(_SoAIterator it, difference_type n) noexcept { return it -= n; }
+        constexpr friend difference_type operator-(const _SoAIterator& a, const _SoAIterator& b) noexcept { return a._Index - b._Index; }
+
+        constexpr bool operator==(const _SoAIterator& other) const noexcept { return (_Index == other._Index); }
+        constexpr auto operator<=>(const _SoAIterator& other) const noexcept { return (_Index <=> other._Index); }
+
+    private:
+        _Owner* _List = nullptr;
+        std::ptrdiff_t _Index = 0;
+    };
+
+    // **************************************** SoAList<Fields...> ****************************************
+
+#if 1
+    // SoAList<Fields...> - Non-Template Member Functions
+
+    template <class... Fields>
+    constexpr void SoAList<Fields...>::Add(const Fields&... values)
+    {
+        _Add(std::index_sequence_for<Fields...>(), values...);
+    }
+
+    template <class... Fields>
+    constexpr void SoAList<Fields...>::Add(Fields&&... values)
+    {
+        _Add(std::index_sequence_for<Fields...>(), std::move(values)...);
+    }
+
+    template <class... Fields>
+    constexpr void SoAList<Fields...>::Clear() noexcept
+    {
+        std::apply([](auto&... columns) { (columns.Clear(), ...); }, _Columns);
+    }
+
+    template <class... Fields>
+    constexpr std::size_t SoAList<Fields...>::Count() const noexcept
+    {
+        return std::get<0>(_Columns).Count();
+    }
+
+    template <class... Fields>
+    constexpr void SoAList<Fields...>::RemoveAt(std::size_t index)
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        std::apply([index](auto&... columns) { (columns.RemoveAt(index), ...); }, _Columns);
+    }
+
+    template <class... Fields>
+    constexpr void SoAList<Fields...>::Reserve(std::size_t capacity)
+    {
+        std::apply([capacity](auto&... columns) { (columns.Reserve(capacity), ...); }, _Columns);
+    }
+
+    template <class... Fields>
+    constexpr void SoAList<Fields...>::Swap(SoAList<Fields...>& other) noexcept
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) { (std::get<Is>(_Columns).Swap(std::get<Is>(other._Columns)), ...); }(std::index_sequence_for<Fields...>());
+    }
+
+    // SoAList<Fields...> - Template Member Functions
+
+    template <class... Fields>
+    template <std::size_t I>
+    constexpr std::span<typename SoAList<Fields...>::template FieldType<I>> SoAList<Fields...>::Column() noexcept
+    {
+        List<FieldType<I>>& column = std::get<I>(_Columns);
+        return std::span<FieldType<I>>(column.begin(), column.Count());
+    }
+
+    template <class... Fields>
+    template <std::size_t I>
+    constexpr std::span<const typename SoAList<Fields...>::template FieldType<I>> SoAList<Fields...>::Column() const noexcept
+    {
+        const List<FieldType<I>>& column = std::get<I>(_Columns);
+        return std::span<const FieldType<I>>(column.begin(), column.Count());
+    }
+
+    template <class... Fields>
+    template <std::size_t I, std::predicate<const std::tuple_element_t<I, std::tuple<Fields...>>&> _Predicate>
+    constexpr SoAList<Fields...> SoAList<Fields...>::FindAll(_Predicate match) const
+    {
+        const std::span<const FieldType<I>> column = Column<I>();
+
+        List<std::size_t> rows;
+        for (std::size_t i = 0; i < column.size(); i++)
+            if (std::invoke(match, column[i]))
+                rows.Add(i);
+
+        return _Gather(std::index_sequence_for<Fields...>(), rows);
+    }
+
+    template <class... Fields>
+    template <std::size_t I, std::predicate<const std::tuple_element_t<I, std::tuple<Fields...>>&> _Predicate>
+    constexpr std::size_t SoAList<Fields...>::FindIndex(_Predicate match) const
+    {
+        const std::span<const FieldType<I>> column = Column<I>();
+
+        for (std::size_t i = 0; i < column.size(); i++)
+            if (std::invoke(match, column[i]))
+                return i;
+
+        return (std::size_t)(-1);
+    }
+
+    template <class... Fields>
+    template <std::size_t I>
+    constexpr void SoAList<Fields...>::Sort()
+    {
+        Sort<I>(DefaultComparer<FieldType<I>>{});
+    }
+
+    template <class... Fields>
+    template <std::size_t I, std::strict_weak_order<const std::tuple_element_t<I, std::tuple<Fields...>>&, const std::tuple_element_t<I, std::tuple<Fields...>>&> _Compare>
+    constexpr void SoAList<Fields...>::Sort(_Compare compare)
+    {
+        const std::span<const FieldType<I>> keys = Column<I>();
+
+        List<std::size_t> order;
+        order.Reserve(keys.size());
+        for (std::size_t i = 0; i < keys.size(); i++)
+            order.Add(i);
+
+        order.Sort([&](std::size_t a, std::size_t b) { return std::invoke(compare, keys[a], keys[b]); });
+        _Permute(std::index_sequence_for<Fields...>(), order);
+    }
+
+    // SoAList<Fields...> - Iterators
+
+    template <class... Fields>
+    constexpr _SoAIterator<SoAList<Fields...>> SoAList<Fields...>::begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    template <class... Fields>
+    constexpr _SoAIterator<const SoAList<Fields...>> SoAList<Fields...>::begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    template <class... Fields>
+    constexpr _SoAIterator<SoAList<Fields...>> SoAList<Fields...>::end() noexcept
+    {
+        return iterator(this, Count());
+    }
+
+    template <class... Fields>
+    constexpr _SoAIterator<const SoAList<Fields...>> SoAList<Fields...>::end() const noexcept
+    {
+        return const_iterator(this, Count());
+    }
+
+    // SoAList<Fields...> - Operators
+
+    template <class... Fields>
+    constexpr _SoARow<SoAList<Fields...>> SoAList<Fields...>::operator[](std::size_t index)
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        return RowRef(this, index);
+    }
+
+    template <class... Fields>
+    constexpr _SoARow<const SoAList<Fields...>> SoAList<Fields...>::operator[](std::size_t index) const
+    {
+        if (index >= Count())
+            throw std::out_of_range("index");
+
+        return ConstRowRef(this, index);
+    }
+
+    // SoAList<Fields...> - Private Member Functions
+
+    template <class... Fields>
+    template <std::size_t... Is, class... Args>
+    constexpr void SoAList<Fields...>::_Add(std::index_sequence<Is...>, Args&&... values)
+    {
+        std::size_t added = 0;
+        try
+        {
+            ((std::get<Is>(_Columns).Emplace(std::forward<Args>(values)), added++), ...);
+        }
+        catch (...)
+        {
+            // Columns past the one which threw were not reached; the ones before it are one row longer than the rest
+            ((Is < added ? std::get<Is>(_Columns).RemoveAt(std::get<Is>(_Columns).Count() - 1) : void()), ...);
+            throw;
+        }
+    }
+
+    template <class... Fields>
+    template <std::size_t... Is>
+    constexpr SoAList<Fields...> SoAList<Fields...>::_Gather(std::index_sequence<Is...>, const List<std::size_t>& rows) const
+    {
+        SoAList<Fields...> result;
+        result.Reserve(rows.Count());
+
+        auto gather = [&rows](const auto& from, auto& to) {
+            for (std::size_t row : rows)
+                to.Add(from.begin()[row]);
+        };
+        (gather(std::get<Is>(_Columns), std::get<Is>(result._Columns)), ...);
+
+        return result;
+    }
+
+    template <class... Fields>
+    template <std::size_t... Is>
+    constexpr void SoAList<Fields...>::_Permute(std::index_sequence<Is...>, const List<std::size_t>& order)
+    {
+        // Each column is moved over into a new one in the given order, one column at a time
+        auto permute = [&order]<class T>(List<T>& column) {
+            List<T> permuted;
+            permuted.Reserve(order.Count());
+
+            for (std::size_t row : order)
+                permuted.Emplace(std::move(column.begin()[row]));
+
+            column.Swap(permuted);
+        };
+        (permute(std::get<Is>(_Columns)), ...);
+    }
+#endif
+};
+
+// The common reference of a row proxy and the row's value type is the value type, which lets the iterators of SoAList model
+// std::indirectly_readable despite dereferencing to a proxy
+template <class _Owner, class T, template <class> class TQual, template <class> class UQual> requires std::same_as<T, typename _Owner::value_type>
+struct std::basic_common_reference<CQue::_SoARow<_Owner>, T, TQual, UQual>
+{
+    using type = T;
+};
+
+template <class T, class _Owner, template <class> class TQual, template <class> class UQual> requires std::same_as<T, typename _Owner::value_type>
+struct std::basic_common_reference<T, CQue::_SoARow<_Owner>, TQual, UQual>
+{
+    using type = T;
+};
\ No newline at end of file
@@ -0,0 +1,845 @@
+#pragma once
+
+#include "Containers.hpp"
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief A List of at most N items, held inside the object itself, which never allocates. For a literal T it is a literal
+    /// type, so a table filled and sorted during constant evaluation can be kept in a constexpr variable, and for a trivially
+    /// copyable T it is trivially copyable too. Offers the members of List<T, Allocator> but those about the allocator and its
+    /// capacity, and converts to and from a List by way of ToList and the iterable constructor. Adding past N items throws
+    /// std::length_error. Every slot holds an item at all times, a default-constructed one past Count(), hence T has to be
+    /// default initializable, as it has to be for List.
+    /// @tparam T Type of the items
+    /// @tparam N Capacity
+    template <std::default_initializable T, std::size_t N>
+    class StaticList
+    {
+        static_assert(N > 0, "StaticList needs room for at least one item");
+
+    public:
+        // Constructors
+
+        constexpr StaticList() noexcept(std::is_nothrow_default_constructible_v<T>) = default;
+
+        constexpr StaticList(std::size_t initial_size);
+        constexpr StaticList(std::initializer_list<T> lst);
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr StaticList(const _It& lst);
+
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+        constexpr StaticList(_It&& lst);
+
+        template <std::forward_iterator _It>
+        constexpr StaticList(_It first, _It last);
+
+        // Non-Template Member Functions
+
+        constexpr void Add(const T& what);
+        constexpr void Add(T&& what);
+
+        /// @brief Item at the index, throwing std::out_of_range past the end, as operator[] does.
+        constexpr T& At(std::size_t index);
+        constexpr const T& At(std::size_t index) const;
+
+        /// @brief Searches the list, sorted in ascending order, for the item. Returns its index or, if it is not there, the bitwise
+        /// complement of the index at which it would be inserted; see Container::BinarySearch.
+        constexpr std::size_t BinarySearch(const T& what) const;
+
+        static constexpr std::size_t Capacity() noexcept;
+        constexpr void Clear() noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr bool Contains(const T& what) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>;
+        constexpr std::size_t Count() const noexcept;
+
+        /// @brief Pointer to the first of Count() contiguous items.
+        constexpr T* Data() noexcept;
+        constexpr const T* Data() const noexcept;
+
+        constexpr bool Exists(Predicate<const T&> match) const;
+        constexpr T Find(Predicate<const T&> match) const;
+        constexpr StaticList<T, N> FindAll(Predicate<const T&> match) const;
+        constexpr std::size_t FindIndex(Predicate<const T&> match) const;
+        constexpr T FindLast(Predicate<const T&> match) const;
+        constexpr std::size_t FindLastIndex(Predicate<const T&> match) const;
+        constexpr std::size_t IndexOf(const T& what) const noexcept;
+        constexpr void Insert(std::size_t index, const T& what);
+        constexpr void Insert(std::size_t index, T&& what);
+
+        /// @brief Inserts the item into the list, sorted in ascending order, after the items equivalent to it and returns its index.
+        constexpr std::size_t InsertSorted(const T& what);
+        constexpr std::size_t InsertSorted(T&& what);
+
+        constexpr std::size_t LastIndexOf(const T& what) const noexcept;
+        constexpr std::size_t LowerBound(const T& what) const;
+        constexpr bool Remove(const T& what) noexcept;
+        constexpr std::size_t RemoveAll(Predicate<const T&> match);
+        constexpr void RemoveAt(std::size_t index);
+        constexpr void RemoveRange(std::size_t index, std::size_t count);
+
+        /// @brief Does nothing but throw std::length_error if the capacity asked for is more than N, for code written against List.
+        constexpr void Reserve(std::size_t capacity) const;
+
+        constexpr void Resize(std::size_t n);
+        constexpr void Reverse() noexcept(std::is_nothrow_swappable_v<T>);
+        constexpr void Sort();
+        constexpr void Sort(Comparison<T> compare);
+        constexpr void Swap(StaticList<T, N>& other) noexcept(std::is_nothrow_swappable_v<T>);
+
+        /// @brief Item at the index with no bounds check, for loops which already keep the index within Count().
+        constexpr T& UnsafeAt(std::size_t index) noexcept;
+        constexpr const T& UnsafeAt(std::size_t index) const noexcept;
+        constexpr std::size_t UpperBound(const T& what) const;
+
+        // Template Member Functions
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr void AddRange(const _It& what);
+
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+        constexpr void AddRange(_It&& what);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t BinarySearch(const T& what, _Compare compare) const;
+
+        template <class TOutput>
+        constexpr StaticList<TOutput, N> ConvertAll(Converter<T, TOutput> converter = &DefaultConvert<T, TOutput>) const;
+
+        template <class TOutput, ConverterOf<T, TOutput> _Converter>
+        constexpr StaticList<TOutput, N> ConvertAll(_Converter converter) const;
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr void CopyTo(_It& where) const noexcept(std::is_nothrow_copy_assignable_v<T>);
+
+        /// @brief Constructs an item from the given arguments at the end of the list and returns it.
+        template <class... Args> requires std::constructible_from<T, Args...>
+        constexpr T& Emplace(Args&&... args);
+
+        /// @brief Constructs an item from the given arguments at the given index and returns it.
+        template <class... Args> requires std::constructible_from<T, Args...>
+        constexpr T& EmplaceAt(std::size_t index, Args&&... args);
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr bool Exists(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr T Find(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr StaticList<T, N> FindAll(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t FindIndex(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr T FindLast(_Predicate match) const;
+
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t FindLastIndex(_Predicate match) const;
+
+        template <ForwardIterableObjectOf<T> _It>
+        constexpr void InsertRange(std::size_t index, const _It& what);
+
+        template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+        constexpr void InsertRange(std::size_t index, _It&& what);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t InsertSorted(const T& what, _Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t InsertSorted(T&& what, _Compare compare);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t LowerBound(const T& what, _Compare compare) const;
+
+        /// @brief Merges the items of another sorted container into this sorted list in linear time, keeping it sorted. Of
+        /// equivalent items, those of this list come first. Throws std::length_error, leaving the list as it was, if the items
+        /// would not fit.
+        template <ForwardIterableObjectOf<T> _It, std::strict_weak_order<const T&, const T&> _Compare = DefaultComparer<T>>
+        constexpr void MergeSorted(const _It& other, _Compare compare = _Compare());
+
+        /// @brief Removes every item matching the predicate in a single stable pass and returns how many were removed.
+        template <std::predicate<const T&> _Predicate>
+        constexpr std::size_t RemoveAll(_Predicate match);
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr void Sort(_Compare compare);
+
+        template <ThreeWayComparison<T> _Compare>
+        constexpr void Sort(_Compare compare);
+
+        /// @brief Copies the items into a new List.
+        template <class Allocator = std::allocator<T>, GrowthPolicy Growth = DoublingGrowth>
+        constexpr List<T, Allocator, Growth> ToList(const Allocator& alloc = Allocator()) const;
+
+        template <std::strict_weak_order<const T&, const T&> _Compare>
+        constexpr std::size_t UpperBound(const T& what, _Compare compare) const;
+
+        // Iterators
+
+        constexpr T* begin() noexcept;
+        constexpr const T* begin() const noexcept;
+        constexpr T* end() noexcept;
+        constexpr const T* end() const noexcept;
+        constexpr const T* cbegin() const noexcept;
+        constexpr const T* cend() const noexcept;
+
+        // Operators
+
+        constexpr T& operator[](std::size_t index);
+        constexpr const T& operator[](std::size_t index) const;
+
+        constexpr bool operator==(const StaticList<T, N>& other) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>;
+
+    protected:
+        constexpr void _EnsureRoom(std::size_t count) const;
+
+        // Every slot past _Count holds a default-constructed item, so that the copy, move, and destructor may all be implicit
+        T _Items[N] = {};
+        std::size_t _Count = 0;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ***************************************** StaticList<T, N> *****************************************
+
+#if 1
+    // StaticList<T, N> - Constructors
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr StaticList<T, N>::StaticList(std::size_t initial_size)
+    {
+        Resize(initial_size);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr StaticList<T, N>::StaticList(std::initializer_list<T> lst)
+    {
+        AddRange(lst);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr StaticList<T, N>::StaticList(const _It& lst)
+    {
+        AddRange(lst);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr StaticList<T, N>::StaticList(_It&& lst)
+    {
+        AddRange(std::move(lst));
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::forward_iterator _It>
+    constexpr StaticList<T, N>::StaticList(_It first, _It last)
+    {
+        std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+        _EnsureRoom(count);
+
+        std::copy(first, last, _Items);
+        _Count = count;
+    }
+
+    // StaticList<T, N> - Non-Template Member Functions
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Add(const T& what)
+    {
+        Emplace(what);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Add(T&& what)
+    {
+        Emplace(std::move(what));
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T& StaticList<T, N>::At(std::size_t index)
+    {
+        return (*this)[index];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T& StaticList<T, N>::At(std::size_t index) const
+    {
+        return (*this)[index];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::BinarySearch(const T& what) const
+    {
+        return BinarySearch<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::Capacity() noexcept
+    {
+        return N;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Clear() noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        for (std::size_t i = 0; i < _Count; i++)
+            _Items[i] = T();
+
+        _Count = 0;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr bool StaticList<T, N>::Contains(const T& what) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>
+    {
+        return (IndexOf(what) != (std::size_t)(-1));
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::Count() const noexcept
+    {
+        return _Count;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T* StaticList<T, N>::Data() noexcept
+    {
+        return _Items;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T* StaticList<T, N>::Data() const noexcept
+    {
+        return _Items;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr bool StaticList<T, N>::Exists(Predicate<const T&> match) const
+    {
+        return Exists<Predicate<const T&>>(match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T StaticList<T, N>::Find(Predicate<const T&> match) const
+    {
+        return Find<Predicate<const T&>>(match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr StaticList<T, N> StaticList<T, N>::FindAll(Predicate<const T&> match) const
+    {
+        return FindAll<Predicate<const T&>>(match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::FindIndex(Predicate<const T&> match) const
+    {
+        return FindIndex<Predicate<const T&>>(match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T StaticList<T, N>::FindLast(Predicate<const T&> match) const
+    {
+        return FindLast<Predicate<const T&>>(match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::FindLastIndex(Predicate<const T&> match) const
+    {
+        return FindLastIndex<Predicate<const T&>>(match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::IndexOf(const T& what) const noexcept
+    {
+        return Container::IndexOf<T>(*this, what);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Insert(std::size_t index, const T& what)
+    {
+        EmplaceAt(index, what);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Insert(std::size_t index, T&& what)
+    {
+        EmplaceAt(index, std::move(what));
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::InsertSorted(const T& what)
+    {
+        return InsertSorted<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::InsertSorted(T&& what)
+    {
+        return InsertSorted<DefaultComparer<T>>(std::move(what), DefaultComparer<T>{});
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::LastIndexOf(const T& what) const noexcept
+    {
+        return Container::LastIndexOf<T>(*this, what);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::LowerBound(const T& what) const
+    {
+        return LowerBound<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr bool StaticList<T, N>::Remove(const T& what) noexcept
+    {
+        try
+        {
+            std::size_t pos = IndexOf(what);
+            if (pos != (std::size_t)(-1))
+            {
+                RemoveAt(pos);
+                return true;
+            }
+            else
+                return false;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::RemoveAll(Predicate<const T&> match)
+    {
+        return RemoveAll<Predicate<const T&>>(match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::RemoveAt(std::size_t index)
+    {
+        RemoveRange(index, 1);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::RemoveRange(std::size_t index, std::size_t count)
+    {
+        if (index > _Count || count > _Count - index)
+            throw std::out_of_range("where");
+
+        std::move(&_Items[index + count], &_Items[_Count], &_Items[index]);
+        for (std::size_t i = _Count - count; i < _Count; i++)
+            _Items[i] = T();
+
+        _Count -= count;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Reserve(std::size_t capacity) const
+    {
+        if (capacity > N)
+            throw std::length_error("capacity");
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Resize(std::size_t n)
+    {
+        if (n > N)
+            throw std::length_error("capacity");
+
+        // The slots gained already hold default-constructed items
+        for (std::size_t i = n; i < _Count; i++)
+            _Items[i] = T();
+
+        _Count = n;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Reverse() noexcept(std::is_nothrow_swappable_v<T>)
+    {
+        std::reverse(_Items, &_Items[_Count]);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Sort()
+    {
+        Sort<DefaultComparer<T>>(DefaultComparer<T>{});
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Sort(Comparison<T> compare)
+    {
+        Sort<Comparison<T>>(compare);
+    }
+
+    /// @brief Exchanges the contents of two lists item by item, as there is no memory to hand over.
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::Swap(StaticList<T, N>& other) noexcept(std::is_nothrow_swappable_v<T>)
+    {
+        // Past the longer of the two lists both hold default-constructed items
+        std::swap_ranges(_Items, &_Items[std::max(_Count, other._Count)], other._Items);
+        std::swap(_Count, other._Count);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T& StaticList<T, N>::UnsafeAt(std::size_t index) noexcept
+    {
+        return _Items[index];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T& StaticList<T, N>::UnsafeAt(std::size_t index) const noexcept
+    {
+        return _Items[index];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr std::size_t StaticList<T, N>::UpperBound(const T& what) const
+    {
+        return UpperBound<DefaultComparer<T>>(what, DefaultComparer<T>{});
+    }
+
+    // StaticList<T, N> - Template Member Functions
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr void StaticList<T, N>::AddRange(const _It& what)
+    {
+        std::size_t add_count = static_cast<std::size_t>(std::distance(what.begin(), what.end()));
+        _EnsureRoom(add_count);
+
+        std::copy(what.begin(), what.end(), &_Items[_Count]);
+        _Count += add_count;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr void StaticList<T, N>::AddRange(_It&& what)
+    {
+        std::size_t add_count = static_cast<std::size_t>(std::distance(what.begin(), what.end()));
+        _EnsureRoom(add_count);
+
+        std::move(what.begin(), what.end(), &_Items[_Count]);
+        _Count += add_count;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t StaticList<T, N>::BinarySearch(const T& what, _Compare compare) const
+    {
+        return Container::BinarySearch<T, StaticList<T, N>, _Compare>(*this, what, compare);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <class TOutput>
+    constexpr StaticList<TOutput, N> StaticList<T, N>::ConvertAll(Converter<T, TOutput> converter) const
+    {
+        return ConvertAll<TOutput, Converter<T, TOutput>>(converter);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <class TOutput, ConverterOf<T, TOutput> _Converter>
+    constexpr StaticList<TOutput, N> StaticList<T, N>::ConvertAll(_Converter converter) const
+    {
+        StaticList<TOutput, N> out(_Count);
+        for (std::size_t i = 0; i < _Count; i++)
+            out.UnsafeAt(i) = std::invoke(converter, _Items[i]);
+
+        return out;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr void StaticList<T, N>::CopyTo(_It& where) const noexcept(std::is_nothrow_copy_assignable_v<T>)
+    {
+        std::copy(_Items, &_Items[_Count], where.begin());
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <class... Args> requires std::constructible_from<T, Args...>
+    constexpr T& StaticList<T, N>::Emplace(Args&&... args)
+    {
+        _EnsureRoom(1);
+
+        _Items[_Count] = T(std::forward<Args>(args)...);
+        return _Items[_Count++];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <class... Args> requires std::constructible_from<T, Args...>
+    constexpr T& StaticList<T, N>::EmplaceAt(std::size_t index, Args&&... args)
+    {
+        if (index > _Count)
+            throw std::out_of_range("index");
+        _EnsureRoom(1);
+
+        // Built aside first as the arguments may refer to the items about to be shifted
+        T item(std::forward<Args>(args)...);
+        std::move_backward(&_Items[index], &_Items[_Count], &_Items[_Count + 1]);
+        _Items[index] = std::move(item);
+        _Count++;
+
+        return _Items[index];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::predicate<const T&> _Predicate>
+    constexpr bool StaticList<T, N>::Exists(_Predicate match) const
+    {
+        return Container::Exists<T, StaticList<T, N>, _Predicate>(*this, match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::predicate<const T&> _Predicate>
+    constexpr T StaticList<T, N>::Find(_Predicate match) const
+    {
+        return Container::Find<T, StaticList<T, N>, _Predicate>(*this, match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::predicate<const T&> _Predicate>
+    constexpr StaticList<T, N> StaticList<T, N>::FindAll(_Predicate match) const
+    {
+        StaticList<T, N> out;
+        for (std::size_t i = 0; i < _Count; i++)
+            if (std::invoke(match, _Items[i]))
+                out.Add(_Items[i]);
+
+        return out;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t StaticList<T, N>::FindIndex(_Predicate match) const
+    {
+        return Container::FindIndex<T, StaticList<T, N>, _Predicate>(*this, match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::predicate<const T&> _Predicate>
+    constexpr T StaticList<T, N>::FindLast(_Predicate match) const
+    {
+        return Container::FindLast<T, StaticList<T, N>, _Predicate>(*this, match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t StaticList<T, N>::FindLastIndex(_Predicate match) const
+    {
+        return Container::FindLastIndex<T, StaticList<T, N>, _Predicate>(*this, match);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It>
+    constexpr void StaticList<T, N>::InsertRange(std::size_t index, const _It& what)
+    {
+        if (index > _Count)
+            throw std::out_of_range("index");
+
+        // Copied aside first, as the items may be this list's own
+        StaticList<T, N> items(what);
+        InsertRange(index, std::move(items));
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It> requires NonLValueRef<_It>
+    constexpr void StaticList<T, N>::InsertRange(std::size_t index, _It&& what)
+    {
+        if (index > _Count)
+            throw std::out_of_range("index");
+
+        std::size_t add_count = static_cast<std::size_t>(std::distance(what.begin(), what.end()));
+        _EnsureRoom(add_count);
+
+        std::move_backward(&_Items[index], &_Items[_Count], &_Items[_Count + add_count]);
+        std::move(what.begin(), what.end(), &_Items[index]);
+        _Count += add_count;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t StaticList<T, N>::InsertSorted(const T& what, _Compare compare)
+    {
+        std::size_t index = UpperBound<_Compare>(what, compare);
+        Insert(index, what);
+
+        return index;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t StaticList<T, N>::InsertSorted(T&& what, _Compare compare)
+    {
+        std::size_t index = UpperBound<_Compare>(what, compare);
+        Insert(index, std::move(what));
+
+        return index;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t StaticList<T, N>::LowerBound(const T& what, _Compare compare) const
+    {
+        return Container::LowerBound<T, StaticList<T, N>, _Compare>(*this, what, compare);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ForwardIterableObjectOf<T> _It, std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void StaticList<T, N>::MergeSorted(const _It& other, _Compare compare)
+    {
+        auto first = other.begin(), last = other.end();
+        _EnsureRoom(static_cast<std::size_t>(std::distance(first, last)));
+
+        // Merged into a copy, since the items merged in may be this list's own
+        StaticList<T, N> merged;
+        std::size_t index = 0;
+
+        while (index < _Count && first != last)
+        {
+            if (std::invoke(compare, *first, std::as_const(_Items[index])))
+                merged.Emplace(*first++);
+            else
+                merged.Emplace(std::as_const(_Items[index++]));
+        }
+
+        for (; index < _Count; index++)
+            merged.Emplace(std::as_const(_Items[index]));
+        for (; first != last; ++first)
+            merged.Emplace(*first);
+
+        Swap(merged);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::predicate<const T&> _Predicate>
+    constexpr std::size_t StaticList<T, N>::RemoveAll(_Predicate match)
+    {
+        // Items before the first match stay where they are
+        std::size_t kept = 0;
+        while (kept < _Count && !std::invoke(match, std::as_const(_Items[kept])))
+            kept++;
+
+        // Each item kept from then on moves down once, over the gap left by the items removed so far
+        for (std::size_t i = kept + 1; i < _Count; i++)
+            if (!std::invoke(match, std::as_const(_Items[i])))
+                _Items[kept++] = std::move(_Items[i]);
+
+        std::size_t removed = _Count - kept;
+        for (std::size_t i = kept; i < _Count; i++)
+            _Items[i] = T();
+        _Count = kept;
+
+        return removed;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr void StaticList<T, N>::Sort(_Compare compare)
+    {
+        Container::Sort<StaticList<T, N>, T, _Compare>(*this, compare);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <ThreeWayComparison<T> _Compare>
+    constexpr void StaticList<T, N>::Sort(_Compare compare)
+    {
+        Container::Sort<StaticList<T, N>, T, _Compare>(*this, compare);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <class Allocator, GrowthPolicy Growth>
+    constexpr List<T, Allocator, Growth> StaticList<T, N>::ToList(const Allocator& alloc) const
+    {
+        return List<T, Allocator, Growth>(_Items, &_Items[_Count], alloc);
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    template <std::strict_weak_order<const T&, const T&> _Compare>
+    constexpr std::size_t StaticList<T, N>::UpperBound(const T& what, _Compare compare) const
+    {
+        return Container::UpperBound<T, StaticList<T, N>, _Compare>(*this, what, compare);
+    }
+
+    // StaticList<T, N> - Iterators
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T* StaticList<T, N>::begin() noexcept
+    {
+        return _Items;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T* StaticList<T, N>::begin() const noexcept
+    {
+        return _Items;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T* StaticList<T, N>::end() noexcept
+    {
+        return &_Items[_Count];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T* StaticList<T, N>::end() const noexcept
+    {
+        return &_Items[_Count];
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T* StaticList<T, N>::cbegin() const noexcept
+    {
+        return _Items;
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T* StaticList<T, N>::cend() const noexcept
+    {
+        return &_Items[_Count];
+    }
+
+    // StaticList<T, N> - Operators
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr T& StaticList<T, N>::operator[](std::size_t index)
+    {
+        if (index < _Count)
+            return _Items[index];
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr const T& StaticList<T, N>::operator[](std::size_t index) const
+    {
+        if (index < _Count)
+            return _Items[index];
+        else
+            throw std::out_of_range("index");
+    }
+
+    template <std::default_initializable T, std::size_t N>
+    constexpr bool StaticList<T, N>::operator==(const StaticList<T, N>& other) const noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) requires std::equality_comparable<T>
+    {
+        return (_Count == other._Count) && std::equal(_Items, &_Items[_Count], other._Items);
+    }
+
+    // StaticList<T, N> - Protected Member Functions
+
+    /// @brief Throws std::length_error unless there is room for `count` more items.
+    template <std::default_initializable T, std::size_t N>
+    constexpr void StaticList<T, N>::_EnsureRoom(std::size_t count) const
+    {
+        if (count > N - _Count)
+            throw std::length_error("capacity");
+    }
+#endif
+};
\ No newline at end of file
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "ConcurrentQueue.hpp"
+
+#include <exception>
+#include <thread>
+
+// ####################################### FORWARD DECLARATIONS #######################################
+
+namespace CQue
+{
+    /// @brief Fixed set of worker threads running fork/join tasks with work stealing. Each worker keeps the tasks it forks in a
+    /// Chase-Lev deque of its own: it takes them back from the bottom, newest first, while idle threads steal from the top,
+    /// oldest first, which are the largest pieces of a recursively split job. Threads outside the pool hand their tasks over
+    /// through a shared queue. A thread waiting for a task to finish runs other tasks meanwhile, so nested parallelism does not
+    /// tie up threads; idle workers sleep until work is added. Tasks live on the stack of the thread forking them, hence nothing
+    /// is allocated per task. The pool is shareable: every member is thread-safe.
+    class ThreadPool
+    {
+    public:
+        /// @brief Creates a pool letting up to `concurrency` threads work at once, the calling thread included; 0 stands for the
+        /// hardware concurrency. `concurrency - 1` worker threads are started.
+        explicit ThreadPool(std::size_t concurrency = 0);
+        ThreadPool(const ThreadPool&) = delete;
+
+        // Non-Template Member Functions
+
+        /// @brief Number of threads which may run tasks at once, the calling thread included.
+        std::size_t Concurrency() const noexcept;
+
+        /// @brief Pool shared by the application, and used by the CQue::Parallel algorithms, created on first use and sized to
+        /// the hardware concurrency.
+        static ThreadPool& Default();
+
+        // Template Member Functions
+
+        /// @brief Runs both functions, possibly at the same time, and returns once both are done. Should either throw, both
+        /// still run to completion and then one of the exceptions, the first function's if it threw, is rethrown.
+        template <std::invocable _FunctionA, std::invocable _FunctionB>
+        void Invoke(_FunctionA&& a, _FunctionB&& b);
+
+        /// @brief Calls func(i) for every i in [first, last), splitting the range in halves until the pieces hold at most
+        /// `grain` indices. Exceptions are handled as by Invoke; pieces not started yet when one throws still run.
+        template <std::invocable<std::size_t> _Function>
+        void ParallelFor(std::size_t first, std::size_t last, std::size_t grain, _Function&& func);
+
+        // Operators
+
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Destructor
+
+        /// @brief Stops and joins the workers. No task may be running anymore.
+        ~ThreadPool();
+
+    private:
+        struct _Task
+        {
+            explicit _Task(void (*execute)(_Task& task) noexcept) noexcept : Execute(execute) {}
+
+            void (*Execute)(_Task& task) noexcept;
+            std::atomic<bool> Done = false;
+            std::exception_ptr Error;
+        };
+
+        template <class _Function>
+        struct _FunctionTask : _Task
+        {
+            explicit _FunctionTask(_Function& func) noexcept : _Task(&Run), Func(func) {}
+
+            // Flagging the task done hands it back to the forking thread, which may then destroy it; it is not touched afterwards
+            static void Run(_Task& task) noexcept
+            {
+                try
+                {
+                    std::invoke(static_cast<_FunctionTask&>(task).Func);
+                }
+                catch (...)
+                {
+                    task.Error = std::current_exception();
+                }
+
+                task.Done.store(true, std::memory_order_release);
+            }
+
+            _Function& Func;
+        };
+
+        struct _Worker;
+
+        template <class _Function>
+        void _ParallelFor(std::size_t first, std::size_t last, std::size_t grain, _Function& func);
+
+        _Task* _Find() noexcept;
+        void _Join(_Task& task) noexcept;
+        bool _Push(_Task& task) noexcept;
+        void _Run(std::size_t index) noexcept;
+        _Task* _Steal(std::size_t start) noexcept;
+        void _Wake() noexcept;
+
+        // Worker of the current thread, if it belongs to a pool
+        static thread_local _Worker* _Current;
+
+        std::size_t _Concurrency;
+        std::unique_ptr<_Worker[]> _Workers;
+        List<std::thread> _Threads;
+        ConcurrentQueue<_Task*> _Injected;
+
+        // Bumped whenever work is added, so that workers about to sleep can tell whether they missed any
+        alignas(CacheLineSize) std::atomic<std::uint32_t> _Epoch;
+        std::atomic<std::size_t> _Sleeping;
+        std::atomic<bool> _Stopping;
+    };
+};
+
+// ######################################## BODY DECLARATIONS #########################################
+
+namespace CQue
+{
+    // ******************************************** ThreadPool ********************************************
+
+    template <std::invocable _FunctionA, std::invocable _FunctionB>
+    void ThreadPool::Invoke(_FunctionA&& a, _FunctionB&& b)
+    {
+        _FunctionTask<std::remove_reference_t<_FunctionB>> task(b);
+
+        // A full deque or queue only costs parallelism: the second function then just runs after the first
+        bool forked = (_Concurrency > 1) && _Push(task);
+
+        std::exception_ptr error;
+        try
+        {
+            std::invoke(a);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        if (forked)
+            _Join(task);
+        else
+            task.Execute(task);
+
+        if (error)
+            std::rethrow_exception(error);
+
+        if (task.Error)
+            std::rethrow_exception(task.Error);
+    }
+
+    template <std::invocable<std::size_t> _Function>
+    void ThreadPool::ParallelFor(std::size_t first, std::size_t last, std::size_t grain, _Function&& func)
+    {
+        if (first < last)
+            _ParallelFor(first, last, std::max<std::size_t>(grain, 1), func);
+    }
+
+    template <class _Function>
+    void ThreadPool::_ParallelFor(std::size_t first, std::size_t last, std::size_t grain, _Function& func)
+    {
+        if (last - first <= grain || _Concurrency == 1)
+        {
+            for (std::size_t i = first; i < last; i++)
+                std::invoke(func, i);
+
+            return;
+        }
+
+        // The first half is run right away, the second is left for a thief or taken back once the first is done
+        std::size_t middle = first + (last - first) / 2;
+        Invoke([&]() { _ParallelFor(first, middle, grain, func); }, [&]() { _ParallelFor(middle, last, grain, func); });
+    }
+};
\ No newline at end of file
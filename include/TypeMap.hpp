@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Any.hpp"
+#include "Containers.hpp"
+
+namespace CQue
+{
+	// ####################################### FORWARD DECLARATIONS #######################################
+
+	/// @brief Slots indexed by the types' registry indices (TypeTag::GetIndex()), as kept by TypeMap and AnyList. Reading an
+	/// index past the slots yields a shared default slot, via a bounds check compiled to a select; writing one makes room for it.
+	/// @tparam T Default-constructible type of the slots, whose default value stands for an unused slot
+	template <class T>
+	class _TypeSlots
+	{
+	public:
+		/// @brief Slot of the index, or the default slot if there is no such slot yet.
+		const T& Find(std::size_t index) const noexcept;
+
+		/// @brief Slot of the index, made room for if need be.
+		T& At(std::size_t index);
+
+		T* begin() const noexcept;
+		T* end() const noexcept;
+
+	private:
+		// Slot of the indices with no slot, never written to
+		static inline const T _None{};
+
+		List<T> _Slots;
+	};
+
+	/// @brief Holds at most one value per type, e.g. one cached or pooled instance of each, looked up by type. Values sit in a
+	/// List<Any> indexed by the types' registry indices (TypeTag::GetIndex()), so a lookup is an indexed load: past the first
+	/// use of a type, getting a value costs one atomic load of its index, a bounds check compiled to a select, and a null
+	/// check, with no hashing or comparison of types. Not synchronized; share a TypeMap between threads only for reading.
+	class TypeMap
+	{
+	public:
+		/// @brief Creates an empty map whose values draw any heap storage they need from the given memory resource; null stands
+		/// for new and delete.
+		explicit TypeMap(std::pmr::memory_resource* resource = nullptr) noexcept;
+
+		// Non-Template Member Functions
+
+		void Clear() noexcept;
+		bool Contains(const TypeTag& tag) const;
+		std::size_t Count() const noexcept;
+
+		/// @brief Value of the given type, or nullptr if there is none.
+		const Any* Find(const TypeTag& tag) const;
+
+		bool Remove(const TypeTag& tag);
+
+		// Template Member Functions
+
+		template <NonRef T>
+		bool Contains() const;
+
+		/// @brief Replaces the value of type T with one constructed in place from the arguments, and returns it.
+		template <NonRef T, class... Args>
+		T& Emplace(Args&&... args);
+
+		/// @brief Value of type T, throwing std::out_of_range if there is none.
+		template <NonRef T>
+		T& Get();
+
+		template <NonRef T>
+		const T& Get() const;
+
+		template <NonRef T>
+		bool Remove();
+
+		/// @brief Replaces the value of the value's type.
+		template <class T>
+		std::decay_t<T>& Set(T&& value);
+
+		/// @brief Value of type T, or nullptr if there is none.
+		template <NonRef T>
+		T* TryGet();
+
+		template <NonRef T>
+		const T* TryGet() const;
+
+	private:
+		_TypeSlots<Any> _Slots;
+		std::size_t _Count;
+		std::pmr::memory_resource* _Resource;
+	};
+
+	// ######################################## BODY DECLARATIONS #########################################
+
+	// ****************************************** _TypeSlots<T> *******************************************
+
+	template <class T>
+	const T& _TypeSlots<T>::Find(std::size_t index) const noexcept
+	{
+		return *((index < _Slots.Count()) ? _Slots.begin() + index : &_None);
+	}
+
+	template <class T>
+	T& _TypeSlots<T>::At(std::size_t index)
+	{
+		// Room is made for every type registered so far, as those are the likeliest to be added next
+		if (index >= _Slots.Count())
+			_Slots.Resize(std::max(index + 1, TypeTag::RegisteredCount()));
+
+		return _Slots.begin()[index];
+	}
+
+	template <class T>
+	T* _TypeSlots<T>::begin() const noexcept
+	{
+		return _Slots.begin();
+	}
+
+	template <class T>
+	T* _TypeSlots<T>::end() const noexcept
+	{
+		return _Slots.end();
+	}
+
+	// ********************************************* TypeMap **********************************************
+
+	template <NonRef T>
+	bool TypeMap::Contains() const
+	{
+		return (TryGet<T>() != nullptr);
+	}
+
+	template <NonRef T, class... Args>
+	T& TypeMap::Emplace(Args&&... args)
+	{
+		using _Manager = Any::_Manager<T>;
+
+		// Created aside first, since the arguments may refer to the value being replaced
+		Any value;
+		_Manager::Create(value._Data, _Resource, std::forward<Args>(args)...);
+		value._ptrOps = Any::_OperationsOf<T>;
+
+		// The slot takes the map's resource as well, for copies of it to allocate from
+		Any& slot = _Slots.At(GetType<T>().GetIndex());
+		_Count += slot.IsEmpty();
+		slot._Resource = _Resource;
+		slot = std::move(value);
+
+		return *_Manager::Get(slot._Data);
+	}
+
+	template <NonRef T>
+	T& TypeMap::Get()
+	{
+		return const_cast<T&>(std::as_const(*this).Get<T>());
+	}
+
+	template <NonRef T>
+	const T& TypeMap::Get() const
+	{
+		const T* value = TryGet<T>();
+		if (!value)
+			throw std::out_of_range("type");
+
+		return *value;
+	}
+
+	template <NonRef T>
+	bool TypeMap::Remove()
+	{
+		return Remove(GetType<T>());
+	}
+
+	template <class T>
+	std::decay_t<T>& TypeMap::Set(T&& value)
+	{
+		return Emplace<std::decay_t<T>>(std::forward<T>(value));
+	}
+
+	template <NonRef T>
+	T* TypeMap::TryGet()
+	{
+		return const_cast<T*>(std::as_const(*this).TryGet<T>());
+	}
+
+	template <NonRef T>
+	const T* TypeMap::TryGet() const
+	{
+		// The slot of a type only ever holds a value of that type, which spares comparing the types
+		const Any& slot = _Slots.Find(GetType<T>().GetIndex());
+		return slot._ptrOps ? Any::_Manager<T>::Get(slot._Data) : nullptr;
+	}
+};
\ No newline at end of file
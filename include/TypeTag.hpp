@@ -11,23 +11,78 @@ namespace CQue
 
 		std::uint64_t GetID() const noexcept;
 
+		/// @brief Name of the type as spelled by the compiler, e.g. "int" or "CQue::Any".
+		constexpr std::string_view GetName() const noexcept;
+
+		/// @brief 64-bit FNV-1a hash of GetName(). Unlike GetID(), the value is known at compile time and stays the same across
+		/// runs, processes, and shared libraries as long as they are built by the same compiler.
+		constexpr std::uint64_t GetStableID() const noexcept;
+
+		/// @brief Dense index (0, 1, 2, ...) of the type in the global registry, assigned the first time it is requested for the
+		/// type. Thread-safe; once assigned, retrieving it is a single atomic load.
+		std::size_t GetIndex() const;
+
+		/// @brief Number of types which have been given a registry index so far.
+		static std::size_t RegisteredCount() noexcept;
+
 		friend class Any;
 
 		template <class T>
 		friend constexpr const TypeTag& GetType() noexcept;
 
 	private:
-		constexpr TypeTag() noexcept = default;
+		constexpr TypeTag(std::string_view name, std::atomic<std::size_t>* index) noexcept;
 
 		template <class T>
 		struct _TagGenerator;
+
+		template <class T>
+		static constexpr std::string_view _Signature() noexcept;
+
+		template <class T>
+		static constexpr std::string_view _NameOf() noexcept;
+
+		static constexpr std::uint64_t _Hash(std::string_view what) noexcept;
+
+		std::size_t _Register() const;
+
+		static constexpr std::size_t _Unregistered = (std::size_t)(-1);
+
+		std::string_view _Name;
+		std::uint64_t _StableID;
+		std::atomic<std::size_t>* _ptrIndex;
+	};
+
+	/// @brief Maps types to handlers by their registry indices so that dispatching on a TypeTag is an indexed load instead of a
+	/// chain of comparisons. Registration is not synchronized with lookups; fill the table before sharing it between threads.
+	/// @tparam R Return type of the handlers
+	/// @tparam ...Args Parameter types of the handlers
+	template <class R, class... Args>
+	class TypeDispatchTable
+	{
+	public:
+		using Handler = R(*)(Args...);
+
+		TypeDispatchTable(Handler fallback = nullptr) noexcept;
+
+		template <class T>
+		void Register(Handler handler);
+		void Register(const TypeTag& tag, Handler handler);
+
+		Handler Lookup(const TypeTag& tag) const;
+		R Dispatch(const TypeTag& tag, Args... args) const;
+
+	private:
+		std::vector<Handler> _Handlers;
+		Handler _Fallback;
 	};
 
 	template <class T>
 	struct TypeTag::_TagGenerator
 	{
 	public:
-		static inline const TypeTag Tag = TypeTag();
+		static inline std::atomic<std::size_t> Index = TypeTag::_Unregistered;
+		static constexpr TypeTag Tag = TypeTag(TypeTag::_NameOf<T>(), &Index);
 	};
 
 	constexpr bool operator==(const TypeTag& a, const TypeTag& b) noexcept
@@ -40,4 +95,98 @@ namespace CQue
 	{
 		return TypeTag::_TagGenerator<T>::Tag;
 	}
+
+	// ********************************************* TypeTag **********************************************
+
+	constexpr TypeTag::TypeTag(std::string_view name, std::atomic<std::size_t>* index) noexcept : _Name(name), _StableID(_Hash(name)), _ptrIndex(index) {}
+
+	constexpr std::string_view TypeTag::GetName() const noexcept
+	{
+		return _Name;
+	}
+
+	constexpr std::uint64_t TypeTag::GetStableID() const noexcept
+	{
+		return _StableID;
+	}
+
+	inline std::size_t TypeTag::GetIndex() const
+	{
+		std::size_t index = _ptrIndex->load(std::memory_order_acquire);
+		return (index != _Unregistered) ? index : _Register();
+	}
+
+	template <class T>
+	constexpr std::string_view TypeTag::_Signature() noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		return __FUNCSIG__;
+#else
+		return __PRETTY_FUNCTION__;
+#endif
+	}
+
+	template <class T>
+	constexpr std::string_view TypeTag::_NameOf() noexcept
+	{
+		// The signature of _Signature<void>() tells where the type name starts and how much trails after it
+		constexpr std::string_view probe = _Signature<void>();
+		constexpr std::size_t prefix = probe.find("void");
+		constexpr std::size_t suffix = probe.size() - prefix - std::string_view("void").size();
+
+		constexpr std::string_view signature = _Signature<T>();
+		return signature.substr(prefix, signature.size() - prefix - suffix);
+	}
+
+	constexpr std::uint64_t TypeTag::_Hash(std::string_view what) noexcept
+	{
+		std::uint64_t hash = 0xcbf29ce484222325ull;
+		for (char c : what)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 0x100000001b3ull;
+		}
+
+		return hash;
+	}
+
+	// ********************************** TypeDispatchTable<R, Args...> ***********************************
+
+	template <class R, class... Args>
+	TypeDispatchTable<R, Args...>::TypeDispatchTable(Handler fallback) noexcept : _Handlers(), _Fallback(fallback) {}
+
+	template <class R, class... Args>
+	template <class T>
+	void TypeDispatchTable<R, Args...>::Register(Handler handler)
+	{
+		Register(GetType<T>(), handler);
+	}
+
+	template <class R, class... Args>
+	void TypeDispatchTable<R, Args...>::Register(const TypeTag& tag, Handler handler)
+	{
+		std::size_t index = tag.GetIndex();
+		if (index >= _Handlers.size())
+			_Handlers.resize(index + 1, nullptr);
+
+		_Handlers[index] = handler;
+	}
+
+	template <class R, class... Args>
+	typename TypeDispatchTable<R, Args...>::Handler TypeDispatchTable<R, Args...>::Lookup(const TypeTag& tag) const
+	{
+		std::size_t index = tag.GetIndex();
+		Handler handler = (index < _Handlers.size()) ? _Handlers[index] : nullptr;
+
+		return handler ? handler : _Fallback;
+	}
+
+	template <class R, class... Args>
+	R TypeDispatchTable<R, Args...>::Dispatch(const TypeTag& tag, Args... args) const
+	{
+		if (Handler handler = Lookup(tag))
+			return handler(std::forward<Args>(args)...);
+		else
+			throw std::out_of_range("tag");
+	}
 };
\ No newline at end of file
@@ -1,16 +1,29 @@
 #pragma once
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <compare>
 #include <concepts>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+// Lets empty members such as stateless allocators take up no space
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CQUE_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define CQUE_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 namespace CQue
 {
     template<class Lambda, int = (Lambda{}(), 0) >
@@ -26,6 +39,18 @@ namespace CQue
     template <class T>
     constexpr bool is_move_default_constexpr_declarable = is_constexpr_evaluated_func([]() -> T { return T(T()); });
 
+    // Types for which moving to a new address and destroying the source is equivalent to copying the bytes over. Specialize it 
+    // as std::true_type for user-defined types satisfying that to let containers relocate them with memcpy/memmove.
+    template <class T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+    template <class T>
+    constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    // Size of the blocks processors keep coherent between cores; data written by different threads is kept this far apart to
+    // avoid false sharing. std::hardware_destructive_interference_size is not used as it may differ between compiler flags.
+    inline constexpr std::size_t CacheLineSize = 64;
+
 
 
     template <class TFrom, class TWhat>
@@ -65,6 +90,39 @@ namespace CQue
         return static_cast<std::partial_ordering>(a <=> b);
     }
 
+    // Function object counterpart of DefaultCompare for the callable overloads, where it can be inlined unlike a function pointer
+    template <class T>
+    struct DefaultComparer
+    {
+        constexpr bool operator()(const T& a, const T& b) const noexcept(noexcept(a < b))
+        {
+            return a < b;
+        }
+    };
+
+    // Callables comparing in the manner of DefaultCompare, i.e. by returning std::partial_ordering or a stronger ordering
+    template <class TComp, class T>
+    concept ThreeWayComparison = std::invocable<TComp&, const T&, const T&> && std::convertible_to<std::invoke_result_t<TComp&, const T&, const T&>, std::partial_ordering>;
+
+    template <class TConv, class TInput, class TOutput>
+    concept ConverterOf = std::invocable<TConv&, std::add_const_t<TInput>&> && std::convertible_to<std::invoke_result_t<TConv&, std::add_const_t<TInput>&>, TOutput>;
+
+    /// @brief Tells a container how many items to make room for once it runs out: NextCapacity(capacity, required, item_size)
+    /// returns at least `required`, given the current capacity and the size of an item in bytes.
+    template <class TGrowth>
+    concept GrowthPolicy = requires(std::size_t n)
+    {
+        { TGrowth::NextCapacity(n, n, n) } noexcept -> std::convertible_to<std::size_t>;
+    };
+
+    /// @brief Allocator able to grow a block in place: TryExpand(where, n, new_n) returns whether the block at `where`, allocated
+    /// for n items, could be made to hold new_n items without moving. If so, it is to be deallocated as a block of new_n items.
+    template <class TAlloc>
+    concept ExpandableAllocator = requires(TAlloc& alloc, typename std::allocator_traits<TAlloc>::pointer where, std::size_t n)
+    {
+        { alloc.TryExpand(where, n, n) } noexcept -> std::same_as<bool>;
+    };
+
     
 
     template <class T>
@@ -0,0 +1,279 @@
+#include "Allocators.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace CQue
+{
+	namespace
+	{
+		constexpr std::size_t RoundUp(std::size_t n, std::size_t multiple) noexcept
+		{
+			return (n + multiple - 1) / multiple * multiple;
+		}
+
+		constexpr std::size_t MinimumChunkSize = 256;
+
+		// Size of a transparent huge page on x86-64 and of the commonest one elsewhere
+		constexpr std::size_t HugePageSize = std::size_t(2) << 20;
+	}
+
+	// ****************************************** MonotonicArena ******************************************
+
+	MonotonicArena::MonotonicArena(std::size_t chunk_size, std::pmr::memory_resource* upstream) noexcept : _ptrUpstream(upstream), _Chunks(nullptr),
+		_Begin(nullptr), _Cursor(nullptr), _End(nullptr), _InitialBuffer(nullptr), _InitialSize(0), _ChunkSize(std::max(chunk_size, MinimumChunkSize)),
+		_NextChunkSize(_ChunkSize), _UsedBefore(0) {}
+
+	MonotonicArena::MonotonicArena(void* buffer, std::size_t size, std::pmr::memory_resource* upstream) noexcept : MonotonicArena(size, upstream)
+	{
+		_InitialBuffer = static_cast<unsigned char*>(buffer);
+		_InitialSize = size;
+
+		_Begin = _Cursor = _InitialBuffer;
+		_End = _InitialBuffer + size;
+	}
+
+	std::size_t MonotonicArena::BytesUsed() const noexcept
+	{
+		return _UsedBefore + static_cast<std::size_t>(_Cursor - _Begin);
+	}
+
+	void MonotonicArena::Release() noexcept
+	{
+		while (_Chunks)
+		{
+			_Chunk* next = _Chunks->Next;
+			_ptrUpstream->deallocate(_Chunks, _Chunks->Size, alignof(std::max_align_t));
+			_Chunks = next;
+		}
+
+		_Begin = _Cursor = _InitialBuffer;
+		_End = _InitialBuffer ? _InitialBuffer + _InitialSize : nullptr;
+		_NextChunkSize = _ChunkSize;
+		_UsedBefore = 0;
+	}
+
+	void MonotonicArena::Reset() noexcept
+	{
+		if (!_Chunks)
+		{
+			Release();
+			return;
+		}
+
+		_Chunk* largest = _Chunks;
+		for (_Chunk* chunk = _Chunks->Next; chunk; chunk = chunk->Next)
+			if (chunk->Size > largest->Size)
+				largest = chunk;
+
+		while (_Chunks)
+		{
+			_Chunk* next = _Chunks->Next;
+			if (_Chunks != largest)
+				_ptrUpstream->deallocate(_Chunks, _Chunks->Size, alignof(std::max_align_t));
+
+			_Chunks = next;
+		}
+
+		largest->Next = nullptr;
+		_Chunks = largest;
+
+		_Begin = _Cursor = reinterpret_cast<unsigned char*>(largest) + RoundUp(sizeof(_Chunk), alignof(std::max_align_t));
+		_End = reinterpret_cast<unsigned char*>(largest) + largest->Size;
+		_UsedBefore = 0;
+	}
+
+	MonotonicArena::~MonotonicArena()
+	{
+		Release();
+	}
+
+	void* MonotonicArena::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		return Allocate(bytes, alignment);
+	}
+
+	void MonotonicArena::do_deallocate(void*, std::size_t, std::size_t) {}
+
+	bool MonotonicArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return (this == &other);
+	}
+
+	void* MonotonicArena::_AllocateSlow(std::size_t bytes, std::size_t alignment)
+	{
+		constexpr std::size_t header = RoundUp(sizeof(_Chunk), alignof(std::max_align_t));
+
+		// Worst case, aligning the cursor wastes alignment - 1 bytes in front of the allocation
+		if (bytes > std::numeric_limits<std::size_t>::max() - header - alignment)
+			throw std::bad_alloc();
+
+		std::size_t size = std::max(_NextChunkSize, header + bytes + alignment);
+
+		_Chunk* chunk = ::new (_ptrUpstream->allocate(size, alignof(std::max_align_t))) _Chunk{ _Chunks, size };
+		_Chunks = chunk;
+
+		_UsedBefore += static_cast<std::size_t>(_Cursor - _Begin);
+		_Begin = _Cursor = reinterpret_cast<unsigned char*>(chunk) + header;
+		_End = reinterpret_cast<unsigned char*>(chunk) + size;
+
+		if (size <= std::numeric_limits<std::size_t>::max() / 2)
+			_NextChunkSize = size * 2;
+
+		void* where = _Cursor;
+		std::size_t space = size - header;
+		std::align(alignment, bytes, where, space);
+
+		_Cursor = static_cast<unsigned char*>(where) + bytes;
+		return where;
+	}
+
+	// ******************************************** FixedPool *********************************************
+
+	FixedPool::FixedPool(std::size_t block_size, std::size_t blocks_per_chunk, std::pmr::memory_resource* upstream) noexcept : _ptrUpstream(upstream),
+		_Free(nullptr), _Chunks(nullptr), _BlockSize(RoundUp(std::max(block_size, sizeof(_FreeBlock)), alignof(_FreeBlock))), _BlockAlignment(0),
+		_BlocksPerChunk(std::max<std::size_t>(blocks_per_chunk, 1))
+	{
+		// Blocks sit at multiples of the block size past a maximally aligned start, hence they are aligned to its lowest set bit
+		_BlockAlignment = std::min(_BlockSize & (~_BlockSize + 1), alignof(std::max_align_t));
+	}
+
+	void FixedPool::Release() noexcept
+	{
+		const std::size_t size = RoundUp(sizeof(_Chunk), alignof(std::max_align_t)) + _BlockSize * _BlocksPerChunk;
+
+		while (_Chunks)
+		{
+			_Chunk* next = _Chunks->Next;
+			_ptrUpstream->deallocate(_Chunks, size, alignof(std::max_align_t));
+			_Chunks = next;
+		}
+
+		_Free = nullptr;
+	}
+
+	FixedPool::~FixedPool()
+	{
+		Release();
+	}
+
+	void* FixedPool::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		return Allocate(bytes, alignment);
+	}
+
+	void FixedPool::do_deallocate(void* where, std::size_t bytes, std::size_t alignment)
+	{
+		Deallocate(where, bytes, alignment);
+	}
+
+	bool FixedPool::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return (this == &other);
+	}
+
+	void FixedPool::_Refill()
+	{
+		constexpr std::size_t header = RoundUp(sizeof(_Chunk), alignof(std::max_align_t));
+		const std::size_t size = header + _BlockSize * _BlocksPerChunk;
+
+		_Chunks = ::new (_ptrUpstream->allocate(size, alignof(std::max_align_t))) _Chunk{ _Chunks };
+
+		// Threaded back to front so that blocks are handed out in address order
+		unsigned char* blocks = reinterpret_cast<unsigned char*>(_Chunks) + header;
+		for (std::size_t i = _BlocksPerChunk; i > 0; i--)
+			_Free = ::new (blocks + (i - 1) * _BlockSize) _FreeBlock{ _Free };
+	}
+
+	// ********************************************** Pages ***********************************************
+
+	std::size_t SystemPageSize() noexcept
+	{
+		static const std::size_t size = []
+		{
+#if defined(_WIN32)
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return static_cast<std::size_t>(info.dwPageSize);
+#else
+			return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		}();
+
+		return size;
+	}
+
+	void* _ReservePages(std::size_t bytes)
+	{
+#if defined(_WIN32)
+		// Large pages need a privilege most processes lack, hence Windows gets regular pages only
+		void* where = VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+		if (!where)
+			throw std::bad_alloc();
+
+		return where;
+#else
+		// Ranges that can hold a huge page are over-reserved and trimmed so that they start on a huge page boundary
+		const bool huge = bytes >= HugePageSize && bytes <= std::numeric_limits<std::size_t>::max() - HugePageSize;
+		const std::size_t reserved = huge ? bytes + HugePageSize : bytes;
+
+		void* mapping = mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (mapping == MAP_FAILED)
+			throw std::bad_alloc();
+
+		if (!huge)
+			return mapping;
+
+		unsigned char* begin = static_cast<unsigned char*>(mapping);
+		unsigned char* where = begin + RoundUp(reinterpret_cast<std::uintptr_t>(begin), HugePageSize) - reinterpret_cast<std::uintptr_t>(begin);
+
+		if (where != begin)
+			munmap(begin, static_cast<std::size_t>(where - begin));
+		if (std::size_t tail = reserved - static_cast<std::size_t>(where - begin) - bytes; tail > 0)
+			munmap(where + bytes, tail);
+
+#if defined(MADV_HUGEPAGE)
+		// Only a hint: the range works the same, just with more TLB misses, where it is not taken
+		madvise(where, bytes, MADV_HUGEPAGE);
+#endif
+
+		return where;
+#endif
+	}
+
+	bool _CommitPages(void* where, std::size_t bytes) noexcept
+	{
+		if (bytes == 0)
+			return true;
+
+		const std::size_t page = SystemPageSize();
+		const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(where) / page * page;
+		const std::uintptr_t last = RoundUp(reinterpret_cast<std::uintptr_t>(where) + bytes, page);
+
+#if defined(_WIN32)
+		return VirtualAlloc(reinterpret_cast<void*>(first), last - first, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+		return mprotect(reinterpret_cast<void*>(first), last - first, PROT_READ | PROT_WRITE) == 0;
+#endif
+	}
+
+	void _ReleasePages(void* where, std::size_t bytes) noexcept
+	{
+#if defined(_WIN32)
+		(void)bytes;
+		VirtualFree(where, 0, MEM_RELEASE);
+#else
+		munmap(where, bytes);
+#endif
+	}
+};
\ No newline at end of file
@@ -0,0 +1,20 @@
+#include "AnyList.hpp"
+
+namespace CQue
+{
+	AnyList::AnyList() noexcept : _Segments(), _Count(0) {}
+
+	void AnyList::Clear() noexcept
+	{
+		for (_Segment& segment : _Segments)
+			if (segment.Clear)
+				segment.Clear(segment.Items);
+
+		_Count = 0;
+	}
+
+	std::size_t AnyList::Count() const noexcept
+	{
+		return _Count;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "Instrumentation.hpp"
+
+#include <mutex>
+
+namespace CQue::Instrumentation
+{
+	namespace
+	{
+		struct ThreadCounters;
+
+		// Threads register their counters on first use, and fold them into the totals of exited threads on exit. The counters are
+		// linked into a list of their own, so that registering allocates nothing and cannot fail within Record
+		struct Registry
+		{
+			std::mutex Lock;
+			ThreadCounters* First = nullptr;
+			Counters Exited;
+		};
+
+		Registry& GetRegistry() noexcept
+		{
+			static Registry registry;
+			return registry;
+		}
+
+		struct ThreadCounters
+		{
+			// Only the owning thread writes, hence plain loads and stores suffice; they are atomic so that Totals may read them
+			std::atomic<std::uint64_t> Values[CounterCount] = {};
+
+			ThreadCounters* Previous = nullptr;
+			ThreadCounters* Next = nullptr;
+
+			ThreadCounters() noexcept
+			{
+				Registry& registry = GetRegistry();
+				std::lock_guard lock(registry.Lock);
+
+				Next = registry.First;
+				if (Next)
+					Next->Previous = this;
+				registry.First = this;
+			}
+
+			ThreadCounters(const ThreadCounters&) = delete;
+
+			~ThreadCounters()
+			{
+				Registry& registry = GetRegistry();
+				std::lock_guard lock(registry.Lock);
+
+				registry.Exited += Load();
+
+				(Previous ? Previous->Next : registry.First) = Next;
+				if (Next)
+					Next->Previous = Previous;
+			}
+
+			Counters Load() const noexcept
+			{
+				Counters out;
+				for (std::size_t i = 0; i < CounterCount; i++)
+					out.Values[i] = Values[i].load(std::memory_order_relaxed);
+
+				return out;
+			}
+		};
+
+		ThreadCounters& CurrentThread() noexcept
+		{
+			thread_local ThreadCounters counters;
+			return counters;
+		}
+
+		std::atomic<Hook> CurrentHook = nullptr;
+	}
+
+	std::string_view NameOf(Counter counter) noexcept
+	{
+		constexpr std::string_view names[CounterCount] = { "ListAllocations", "ListReallocations", "ListItemsMoved", "ListBytesMoved",
+			"ListItemsCopied", "AnyInlineStores", "AnyHeapStores", "AnyBadCasts" };
+
+		std::size_t index = static_cast<std::size_t>(counter);
+		return (index < CounterCount) ? names[index] : std::string_view();
+	}
+
+	void Record(Counter counter, std::uint64_t amount) noexcept
+	{
+		std::atomic<std::uint64_t>& value = CurrentThread().Values[static_cast<std::size_t>(counter)];
+		value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+
+		if (Hook hook = CurrentHook.load(std::memory_order_acquire))
+			hook(counter, amount);
+	}
+
+	void Reset() noexcept
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard lock(registry.Lock);
+
+		for (ThreadCounters* thread = registry.First; thread; thread = thread->Next)
+			for (std::atomic<std::uint64_t>& value : thread->Values)
+				value.store(0, std::memory_order_relaxed);
+
+		registry.Exited = Counters();
+	}
+
+	Hook SetHook(Hook hook) noexcept
+	{
+		return CurrentHook.exchange(hook, std::memory_order_acq_rel);
+	}
+
+	Counters ThreadTotals() noexcept
+	{
+		return CurrentThread().Load();
+	}
+
+	Counters Totals() noexcept
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard lock(registry.Lock);
+
+		Counters out = registry.Exited;
+		for (ThreadCounters* thread = registry.First; thread; thread = thread->Next)
+			out += thread->Load();
+
+		return out;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "MappedList.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <system_error>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CQue
+{
+	namespace
+	{
+		constexpr std::size_t RoundUp(std::size_t n, std::size_t multiple) noexcept
+		{
+			return (n + multiple - 1) / multiple * multiple;
+		}
+
+		// Items start on a cache line at least, whatever their alignment
+		constexpr std::size_t MinimumDataAlignment = 64;
+
+		[[noreturn]] void ThrowLastError(const char* what)
+		{
+#if defined(_WIN32)
+			throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), what);
+#else
+			throw std::system_error(errno, std::generic_category(), what);
+#endif
+		}
+	}
+
+	// ******************************************** MappedFile ********************************************
+
+	MappedFile::MappedFile() noexcept : _Data(nullptr), _Size(0) {}
+
+	MappedFile::MappedFile(const std::string& path) : _Data(nullptr), _Size(0)
+	{
+		// The mapping outlives the handles, which are closed as soon as it is made
+#if defined(_WIN32)
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			ThrowLastError("cannot open file");
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size))
+		{
+			DWORD error = GetLastError();
+			CloseHandle(file);
+			throw std::system_error(static_cast<int>(error), std::system_category(), "cannot get file size");
+		}
+
+		// Empty files cannot be mapped, and have nothing to map anyway
+		if (size.QuadPart > 0)
+		{
+			HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			DWORD error = GetLastError();
+			CloseHandle(file);
+
+			if (!mapping)
+				throw std::system_error(static_cast<int>(error), std::system_category(), "cannot map file");
+
+			_Data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			error = GetLastError();
+			CloseHandle(mapping);
+
+			if (!_Data)
+				throw std::system_error(static_cast<int>(error), std::system_category(), "cannot map file");
+
+			_Size = static_cast<std::size_t>(size.QuadPart);
+		}
+		else
+			CloseHandle(file);
+#else
+		int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (file < 0)
+			ThrowLastError("cannot open file");
+
+		struct stat info;
+		if (fstat(file, &info) != 0)
+		{
+			int error = errno;
+			close(file);
+			throw std::system_error(error, std::generic_category(), "cannot get file size");
+		}
+
+		if (info.st_size > 0)
+		{
+			void* where = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, file, 0);
+			int error = errno;
+			close(file);
+
+			if (where == MAP_FAILED)
+				throw std::system_error(error, std::generic_category(), "cannot map file");
+
+			_Data = where;
+			_Size = static_cast<std::size_t>(info.st_size);
+		}
+		else
+			close(file);
+#endif
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept : _Data(std::exchange(other._Data, nullptr)), _Size(std::exchange(other._Size, 0)) {}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			_Unmap();
+
+			_Data = std::exchange(other._Data, nullptr);
+			_Size = std::exchange(other._Size, 0);
+		}
+
+		return *this;
+	}
+
+	const void* MappedFile::Data() const noexcept
+	{
+		return _Data;
+	}
+
+	std::size_t MappedFile::Size() const noexcept
+	{
+		return _Size;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		_Unmap();
+	}
+
+	void MappedFile::_Unmap() noexcept
+	{
+		if (!_Data)
+			return;
+
+#if defined(_WIN32)
+		UnmapViewOfFile(_Data);
+#else
+		munmap(const_cast<void*>(_Data), _Size);
+#endif
+	}
+
+	// ******************************************** MappedList ********************************************
+
+	const void* _OpenMappedList(const MappedFile& file, std::uint64_t type_id, std::size_t item_size, std::size_t item_alignment, std::size_t& count)
+	{
+		MappedListHeader header;
+		if (file.Size() < sizeof(header))
+			throw std::runtime_error("not a list file: too short for a header");
+
+		std::memcpy(&header, file.Data(), sizeof(header));
+
+		if (header.Magic != MappedListHeader::Signature)
+			throw std::runtime_error("not a list file, or one written on a machine of another byte order");
+		if (header.Version != MappedListHeader::CurrentVersion)
+			throw std::runtime_error("list file of an unsupported version");
+		if (header.TypeID != type_id || header.ItemSize != item_size || header.ItemAlignment != item_alignment)
+			throw std::runtime_error("list file holds items of another type");
+
+		// The mapping starts on a page boundary, so an offset aligned for the items leaves them aligned in memory
+		if (header.DataOffset % item_alignment != 0 || header.DataOffset > file.Size() || header.Count > (file.Size() - header.DataOffset) / item_size)
+			throw std::runtime_error("list file is truncated or corrupt");
+
+		count = static_cast<std::size_t>(header.Count);
+		return static_cast<const unsigned char*>(file.Data()) + header.DataOffset;
+	}
+
+	void _SaveMappedList(const std::string& path, std::uint64_t type_id, std::size_t item_size, std::size_t item_alignment, const void* items, std::size_t count)
+	{
+		MappedListHeader header{};
+		header.Magic = MappedListHeader::Signature;
+		header.Version = MappedListHeader::CurrentVersion;
+		header.ItemAlignment = static_cast<std::uint32_t>(item_alignment);
+		header.TypeID = type_id;
+		header.ItemSize = item_size;
+		header.Count = count;
+		header.DataOffset = RoundUp(sizeof(header), std::max(item_alignment, MinimumDataAlignment));
+
+		unsigned char padding[MinimumDataAlignment] = {};
+
+		std::FILE* file = std::fopen(path.c_str(), "wb");
+		if (!file)
+			ThrowLastError("cannot create file");
+
+		// Written in one pass; large lists go straight from the items to the file without an intermediate copy
+		std::size_t gap = static_cast<std::size_t>(header.DataOffset) - sizeof(header);
+		bool written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+
+		while (written && gap > 0)
+		{
+			std::size_t chunk = std::min(gap, sizeof(padding));
+			written = std::fwrite(padding, 1, chunk, file) == chunk;
+			gap -= chunk;
+		}
+
+		if (written && count > 0)
+			written = std::fwrite(items, item_size, count, file) == count;
+
+		int error = errno;
+		if (std::fclose(file) != 0 && written)
+		{
+			error = errno;
+			written = false;
+		}
+
+		if (!written)
+			throw std::system_error(error, std::generic_category(), "cannot write file");
+	}
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "Parallel.hpp"
+
+namespace CQue::Parallel
+{
+	namespace
+	{
+		std::size_t DefaultConcurrency() noexcept
+		{
+			return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+		}
+
+		std::atomic<std::size_t> Threads = DefaultConcurrency();
+	}
+
+	std::size_t Concurrency() noexcept
+	{
+		return Threads.load(std::memory_order_relaxed);
+	}
+
+	void SetConcurrency(std::size_t threads) noexcept
+	{
+		Threads.store(threads ? threads : DefaultConcurrency(), std::memory_order_relaxed);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,276 @@
+#include "SimdKernels.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CQUE_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CQUE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace CQue::Simd
+{
+	namespace
+	{
+		// Fallback for targets without a vector unit to speak of; the compiler is free to vectorize these itself
+		template <class T>
+		std::size_t _ScalarIndexOf(const T* data, std::size_t count, T value) noexcept
+		{
+			for (std::size_t i = 0; i < count; i++)
+				if (data[i] == value)
+					return i;
+
+			return (std::size_t)(-1);
+		}
+
+		template <class T>
+		std::size_t _ScalarLastIndexOf(const T* data, std::size_t count, T value) noexcept
+		{
+			while (count > 0)
+				if (data[--count] == value)
+					return count;
+
+			return (std::size_t)(-1);
+		}
+
+		constexpr _KernelTable ScalarKernels = {
+			"Scalar",
+			&_ScalarIndexOf<std::uint8_t>, &_ScalarIndexOf<std::uint16_t>, &_ScalarIndexOf<std::uint32_t>,
+			&_ScalarIndexOf<std::uint64_t>, &_ScalarIndexOf<float>, &_ScalarIndexOf<double>,
+			&_ScalarLastIndexOf<std::uint8_t>, &_ScalarLastIndexOf<std::uint16_t>, &_ScalarLastIndexOf<std::uint32_t>,
+			&_ScalarLastIndexOf<std::uint64_t>, &_ScalarLastIndexOf<float>, &_ScalarLastIndexOf<double>
+		};
+
+#if defined(CQUE_SIMD_SSE2)
+		struct _Sse2Base
+		{
+			static constexpr std::size_t Width = 16;
+			static constexpr std::size_t BitsPerByte = 1;
+
+			static __m128i Load(const void* where) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(where)); }
+			static __m128i Or(__m128i a, __m128i b) noexcept { return _mm_or_si128(a, b); }
+			static std::uint64_t Mask(__m128i v) noexcept { return static_cast<std::uint32_t>(_mm_movemask_epi8(v)); }
+		};
+
+		template <class T>
+		struct _Sse2Vector;
+
+		template <>
+		struct _Sse2Vector<std::uint8_t> : _Sse2Base
+		{
+			static __m128i Splat(std::uint8_t v) noexcept { return _mm_set1_epi8(static_cast<char>(v)); }
+			static __m128i Equal(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi8(a, b); }
+		};
+
+		template <>
+		struct _Sse2Vector<std::uint16_t> : _Sse2Base
+		{
+			static __m128i Splat(std::uint16_t v) noexcept { return _mm_set1_epi16(static_cast<short>(v)); }
+			static __m128i Equal(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi16(a, b); }
+		};
+
+		template <>
+		struct _Sse2Vector<std::uint32_t> : _Sse2Base
+		{
+			static __m128i Splat(std::uint32_t v) noexcept { return _mm_set1_epi32(static_cast<int>(v)); }
+			static __m128i Equal(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi32(a, b); }
+		};
+
+		template <>
+		struct _Sse2Vector<std::uint64_t> : _Sse2Base
+		{
+			static __m128i Splat(std::uint64_t v) noexcept { return _mm_set1_epi64x(static_cast<long long>(v)); }
+
+			// SSE2 has no 64-bit compare: both halves of a lane must match
+			static __m128i Equal(__m128i a, __m128i b) noexcept
+			{
+				__m128i halves = _mm_cmpeq_epi32(a, b);
+				return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+			}
+		};
+
+		template <>
+		struct _Sse2Vector<float> : _Sse2Base
+		{
+			static __m128i Splat(float v) noexcept { return _mm_castps_si128(_mm_set1_ps(v)); }
+			static __m128i Equal(__m128i a, __m128i b) noexcept { return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))); }
+		};
+
+		template <>
+		struct _Sse2Vector<double> : _Sse2Base
+		{
+			static __m128i Splat(double v) noexcept { return _mm_castpd_si128(_mm_set1_pd(v)); }
+			static __m128i Equal(__m128i a, __m128i b) noexcept { return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))); }
+		};
+
+		constexpr _KernelTable Sse2Kernels = _MakeKernelTable<_Sse2Vector>("SSE2");
+#elif defined(CQUE_SIMD_NEON)
+		// NEON has no movemask; narrowing each 16-bit pair of the comparison by 4 bits leaves 4 mask bits per byte
+		struct _NeonBase
+		{
+			static constexpr std::size_t Width = 16;
+			static constexpr std::size_t BitsPerByte = 4;
+
+			static uint8x16_t Load(const void* where) noexcept { return vld1q_u8(static_cast<const std::uint8_t*>(where)); }
+			static uint8x16_t Or(uint8x16_t a, uint8x16_t b) noexcept { return vorrq_u8(a, b); }
+			static std::uint64_t Mask(uint8x16_t v) noexcept { return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0); }
+		};
+
+		template <class T>
+		struct _NeonVector;
+
+		template <>
+		struct _NeonVector<std::uint8_t> : _NeonBase
+		{
+			static uint8x16_t Splat(std::uint8_t v) noexcept { return vdupq_n_u8(v); }
+			static uint8x16_t Equal(uint8x16_t a, uint8x16_t b) noexcept { return vceqq_u8(a, b); }
+		};
+
+		template <>
+		struct _NeonVector<std::uint16_t> : _NeonBase
+		{
+			static uint8x16_t Splat(std::uint16_t v) noexcept { return vreinterpretq_u8_u16(vdupq_n_u16(v)); }
+			static uint8x16_t Equal(uint8x16_t a, uint8x16_t b) noexcept { return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b))); }
+		};
+
+		template <>
+		struct _NeonVector<std::uint32_t> : _NeonBase
+		{
+			static uint8x16_t Splat(std::uint32_t v) noexcept { return vreinterpretq_u8_u32(vdupq_n_u32(v)); }
+			static uint8x16_t Equal(uint8x16_t a, uint8x16_t b) noexcept { return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b))); }
+		};
+
+		template <>
+		struct _NeonVector<std::uint64_t> : _NeonBase
+		{
+			static uint8x16_t Splat(std::uint64_t v) noexcept { return vreinterpretq_u8_u64(vdupq_n_u64(v)); }
+			static uint8x16_t Equal(uint8x16_t a, uint8x16_t b) noexcept { return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(a), vreinterpretq_u64_u8(b))); }
+		};
+
+		template <>
+		struct _NeonVector<float> : _NeonBase
+		{
+			static uint8x16_t Splat(float v) noexcept { return vreinterpretq_u8_f32(vdupq_n_f32(v)); }
+			static uint8x16_t Equal(uint8x16_t a, uint8x16_t b) noexcept { return vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b))); }
+		};
+
+		template <>
+		struct _NeonVector<double> : _NeonBase
+		{
+			static uint8x16_t Splat(double v) noexcept { return vreinterpretq_u8_f64(vdupq_n_f64(v)); }
+			static uint8x16_t Equal(uint8x16_t a, uint8x16_t b) noexcept { return vreinterpretq_u8_u64(vceqq_f64(vreinterpretq_f64_u8(a), vreinterpretq_f64_u8(b))); }
+		};
+
+		constexpr _KernelTable NeonKernels = _MakeKernelTable<_NeonVector>("NEON");
+#endif
+
+#if defined(CQUE_SIMD_SSE2)
+		bool HasAvx2() noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			int info[4];
+
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+
+			// AVX needs the OS to save the upper halves of the registers
+			__cpuid(info, 1);
+			if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 28)) || (_xgetbv(0) & 6) != 6)
+				return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#else
+			return __builtin_cpu_supports("avx2");
+#endif
+		}
+#endif
+
+		const _KernelTable& PickKernels() noexcept
+		{
+#if defined(CQUE_SIMD_SSE2)
+			if (const _KernelTable* avx2 = _Avx2Kernels(); avx2 && HasAvx2())
+				return *avx2;
+
+			return Sse2Kernels;
+#elif defined(CQUE_SIMD_NEON)
+			return NeonKernels;
+#else
+			return ScalarKernels;
+#endif
+		}
+
+		// Picked once, on first use, so that searches made while other translation units are being initialized work too
+		const _KernelTable& Kernels() noexcept
+		{
+			static const _KernelTable& kernels = PickKernels();
+			return kernels;
+		}
+	}
+
+	std::string_view InstructionSet() noexcept
+	{
+		return Kernels().Name;
+	}
+
+	std::size_t _IndexOf(const std::uint8_t* data, std::size_t count, std::uint8_t value) noexcept
+	{
+		return Kernels().IndexOf8(data, count, value);
+	}
+
+	std::size_t _IndexOf(const std::uint16_t* data, std::size_t count, std::uint16_t value) noexcept
+	{
+		return Kernels().IndexOf16(data, count, value);
+	}
+
+	std::size_t _IndexOf(const std::uint32_t* data, std::size_t count, std::uint32_t value) noexcept
+	{
+		return Kernels().IndexOf32(data, count, value);
+	}
+
+	std::size_t _IndexOf(const std::uint64_t* data, std::size_t count, std::uint64_t value) noexcept
+	{
+		return Kernels().IndexOf64(data, count, value);
+	}
+
+	std::size_t _IndexOf(const float* data, std::size_t count, float value) noexcept
+	{
+		return Kernels().IndexOfFloat(data, count, value);
+	}
+
+	std::size_t _IndexOf(const double* data, std::size_t count, double value) noexcept
+	{
+		return Kernels().IndexOfDouble(data, count, value);
+	}
+
+	std::size_t _LastIndexOf(const std::uint8_t* data, std::size_t count, std::uint8_t value) noexcept
+	{
+		return Kernels().LastIndexOf8(data, count, value);
+	}
+
+	std::size_t _LastIndexOf(const std::uint16_t* data, std::size_t count, std::uint16_t value) noexcept
+	{
+		return Kernels().LastIndexOf16(data, count, value);
+	}
+
+	std::size_t _LastIndexOf(const std::uint32_t* data, std::size_t count, std::uint32_t value) noexcept
+	{
+		return Kernels().LastIndexOf32(data, count, value);
+	}
+
+	std::size_t _LastIndexOf(const std::uint64_t* data, std::size_t count, std::uint64_t value) noexcept
+	{
+		return Kernels().LastIndexOf64(data, count, value);
+	}
+
+	std::size_t _LastIndexOf(const float* data, std::size_t count, float value) noexcept
+	{
+		return Kernels().LastIndexOfFloat(data, count, value);
+	}
+
+	std::size_t _LastIndexOf(const double* data, std::size_t count, double value) noexcept
+	{
+		return Kernels().LastIndexOfDouble(data, count, value);
+	}
+};
\ No newline at end of file
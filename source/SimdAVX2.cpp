@@ -0,0 +1,82 @@
+// Built with AVX2 code generation on x86; only entered once Simd.cpp has checked that the processor supports it
+#include "SimdKernels.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace CQue::Simd
+{
+#if defined(__AVX2__)
+	namespace
+	{
+		struct _Avx2Base
+		{
+			static constexpr std::size_t Width = 32;
+			static constexpr std::size_t BitsPerByte = 1;
+
+			static __m256i Load(const void* where) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(where)); }
+			static __m256i Or(__m256i a, __m256i b) noexcept { return _mm256_or_si256(a, b); }
+			static std::uint64_t Mask(__m256i v) noexcept { return static_cast<std::uint32_t>(_mm256_movemask_epi8(v)); }
+		};
+
+		template <class T>
+		struct _Avx2Vector;
+
+		template <>
+		struct _Avx2Vector<std::uint8_t> : _Avx2Base
+		{
+			static __m256i Splat(std::uint8_t v) noexcept { return _mm256_set1_epi8(static_cast<char>(v)); }
+			static __m256i Equal(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi8(a, b); }
+		};
+
+		template <>
+		struct _Avx2Vector<std::uint16_t> : _Avx2Base
+		{
+			static __m256i Splat(std::uint16_t v) noexcept { return _mm256_set1_epi16(static_cast<short>(v)); }
+			static __m256i Equal(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi16(a, b); }
+		};
+
+		template <>
+		struct _Avx2Vector<std::uint32_t> : _Avx2Base
+		{
+			static __m256i Splat(std::uint32_t v) noexcept { return _mm256_set1_epi32(static_cast<int>(v)); }
+			static __m256i Equal(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi32(a, b); }
+		};
+
+		template <>
+		struct _Avx2Vector<std::uint64_t> : _Avx2Base
+		{
+			static __m256i Splat(std::uint64_t v) noexcept { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+			static __m256i Equal(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi64(a, b); }
+		};
+
+		// Ordered, non-signaling equality: the same answers as operator==
+		template <>
+		struct _Avx2Vector<float> : _Avx2Base
+		{
+			static __m256i Splat(float v) noexcept { return _mm256_castps_si256(_mm256_set1_ps(v)); }
+			static __m256i Equal(__m256i a, __m256i b) noexcept { return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ)); }
+		};
+
+		template <>
+		struct _Avx2Vector<double> : _Avx2Base
+		{
+			static __m256i Splat(double v) noexcept { return _mm256_castpd_si256(_mm256_set1_pd(v)); }
+			static __m256i Equal(__m256i a, __m256i b) noexcept { return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ)); }
+		};
+
+		constexpr _KernelTable Avx2Kernels = _MakeKernelTable<_Avx2Vector>("AVX2");
+	}
+
+	const _KernelTable* _Avx2Kernels() noexcept
+	{
+		return &Avx2Kernels;
+	}
+#else
+	const _KernelTable* _Avx2Kernels() noexcept
+	{
+		return nullptr;
+	}
+#endif
+};
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Simd.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Shared by the translation units of every instruction set. Everything here has internal linkage so that code compiled for one
+// instruction set can never be picked by the linker for another.
+
+namespace CQue::Simd
+{
+	struct _KernelTable
+	{
+		std::string_view Name;
+
+		std::size_t (*IndexOf8)(const std::uint8_t*, std::size_t, std::uint8_t) noexcept;
+		std::size_t (*IndexOf16)(const std::uint16_t*, std::size_t, std::uint16_t) noexcept;
+		std::size_t (*IndexOf32)(const std::uint32_t*, std::size_t, std::uint32_t) noexcept;
+		std::size_t (*IndexOf64)(const std::uint64_t*, std::size_t, std::uint64_t) noexcept;
+		std::size_t (*IndexOfFloat)(const float*, std::size_t, float) noexcept;
+		std::size_t (*IndexOfDouble)(const double*, std::size_t, double) noexcept;
+
+		std::size_t (*LastIndexOf8)(const std::uint8_t*, std::size_t, std::uint8_t) noexcept;
+		std::size_t (*LastIndexOf16)(const std::uint16_t*, std::size_t, std::uint16_t) noexcept;
+		std::size_t (*LastIndexOf32)(const std::uint32_t*, std::size_t, std::uint32_t) noexcept;
+		std::size_t (*LastIndexOf64)(const std::uint64_t*, std::size_t, std::uint64_t) noexcept;
+		std::size_t (*LastIndexOfFloat)(const float*, std::size_t, float) noexcept;
+		std::size_t (*LastIndexOfDouble)(const double*, std::size_t, double) noexcept;
+	};
+
+	/// @brief Kernels of SimdAVX2.cpp; null if the library was not built for x86.
+	const _KernelTable* _Avx2Kernels() noexcept;
+
+	namespace
+	{
+		inline unsigned _LowestBit(std::uint64_t mask) noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return static_cast<unsigned>(index);
+#else
+			return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+		}
+
+		inline unsigned _HighestBit(std::uint64_t mask) noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanReverse64(&index, mask);
+			return static_cast<unsigned>(index);
+#else
+			return 63u - static_cast<unsigned>(__builtin_clzll(mask));
+#endif
+		}
+
+		// _Vector provides Width (bytes per register), BitsPerByte (mask bits per byte), Load, Splat, Equal, Or, and Mask, the
+		// last of which turns a comparison result into a bit mask
+		template <class T, class _Vector>
+		std::size_t _IndexOfKernel(const T* data, std::size_t count, T value) noexcept
+		{
+			constexpr std::size_t lanes = _Vector::Width / sizeof(T);
+			constexpr std::size_t bits = sizeof(T) * _Vector::BitsPerByte;
+			const auto needle = _Vector::Splat(value);
+
+			std::size_t i = 0;
+
+			// Four registers per round; which one matched is only worked out once any of them did
+			for (; i + 4 * lanes <= count; i += 4 * lanes)
+			{
+				auto e0 = _Vector::Equal(_Vector::Load(data + i), needle);
+				auto e1 = _Vector::Equal(_Vector::Load(data + i + lanes), needle);
+				auto e2 = _Vector::Equal(_Vector::Load(data + i + 2 * lanes), needle);
+				auto e3 = _Vector::Equal(_Vector::Load(data + i + 3 * lanes), needle);
+
+				if (_Vector::Mask(_Vector::Or(_Vector::Or(e0, e1), _Vector::Or(e2, e3))))
+				{
+					if (std::uint64_t mask = _Vector::Mask(e0))
+						return i + _LowestBit(mask) / bits;
+					if (std::uint64_t mask = _Vector::Mask(e1))
+						return i + lanes + _LowestBit(mask) / bits;
+					if (std::uint64_t mask = _Vector::Mask(e2))
+						return i + 2 * lanes + _LowestBit(mask) / bits;
+
+					return i + 3 * lanes + _LowestBit(_Vector::Mask(e3)) / bits;
+				}
+			}
+
+			for (; i + lanes <= count; i += lanes)
+				if (std::uint64_t mask = _Vector::Mask(_Vector::Equal(_Vector::Load(data + i), needle)))
+					return i + _LowestBit(mask) / bits;
+
+			for (; i < count; i++)
+				if (data[i] == value)
+					return i;
+
+			return (std::size_t)(-1);
+		}
+
+		template <class T, class _Vector>
+		std::size_t _LastIndexOfKernel(const T* data, std::size_t count, T value) noexcept
+		{
+			constexpr std::size_t lanes = _Vector::Width / sizeof(T);
+			constexpr std::size_t bits = sizeof(T) * _Vector::BitsPerByte;
+			const auto needle = _Vector::Splat(value);
+
+			std::size_t i = count;
+
+			for (; i >= 4 * lanes; i -= 4 * lanes)
+			{
+				const T* block = data + (i - 4 * lanes);
+
+				auto e0 = _Vector::Equal(_Vector::Load(block), needle);
+				auto e1 = _Vector::Equal(_Vector::Load(block + lanes), needle);
+				auto e2 = _Vector::Equal(_Vector::Load(block + 2 * lanes), needle);
+				auto e3 = _Vector::Equal(_Vector::Load(block + 3 * lanes), needle);
+
+				if (_Vector::Mask(_Vector::Or(_Vector::Or(e0, e1), _Vector::Or(e2, e3))))
+				{
+					if (std::uint64_t mask = _Vector::Mask(e3))
+						return i - lanes + _HighestBit(mask) / bits;
+					if (std::uint64_t mask = _Vector::Mask(e2))
+						return i - 2 * lanes + _HighestBit(mask) / bits;
+					if (std::uint64_t mask = _Vector::Mask(e1))
+						return i - 3 * lanes + _HighestBit(mask) / bits;
+
+					return i - 4 * lanes + _HighestBit(_Vector::Mask(e0)) / bits;
+				}
+			}
+
+			for (; i >= lanes; i -= lanes)
+				if (std::uint64_t mask = _Vector::Mask(_Vector::Equal(_Vector::Load(data + (i - lanes)), needle)))
+					return i - lanes + _HighestBit(mask) / bits;
+
+			while (i > 0)
+				if (data[--i] == value)
+					return i;
+
+			return (std::size_t)(-1);
+		}
+
+		template <template <class> class _Vector>
+		constexpr _KernelTable _MakeKernelTable(std::string_view name) noexcept
+		{
+			return {
+				name,
+				&_IndexOfKernel<std::uint8_t, _Vector<std::uint8_t>>,
+				&_IndexOfKernel<std::uint16_t, _Vector<std::uint16_t>>,
+				&_IndexOfKernel<std::uint32_t, _Vector<std::uint32_t>>,
+				&_IndexOfKernel<std::uint64_t, _Vector<std::uint64_t>>,
+				&_IndexOfKernel<float, _Vector<float>>,
+				&_IndexOfKernel<double, _Vector<double>>,
+				&_LastIndexOfKernel<std::uint8_t, _Vector<std::uint8_t>>,
+				&_LastIndexOfKernel<std::uint16_t, _Vector<std::uint16_t>>,
+				&_LastIndexOfKernel<std::uint32_t, _Vector<std::uint32_t>>,
+				&_LastIndexOfKernel<std::uint64_t, _Vector<std::uint64_t>>,
+				&_LastIndexOfKernel<float, _Vector<float>>,
+				&_LastIndexOfKernel<double, _Vector<double>>
+			};
+		}
+	}
+};
\ No newline at end of file
@@ -0,0 +1,254 @@
+#include "ThreadPool.hpp"
+
+namespace CQue
+{
+	namespace
+	{
+		// Tasks handed over by threads outside the pool before any of them has to run inline
+		constexpr std::size_t InjectedCapacity = 1024;
+
+		// Rounds of stealing an idle worker tries before going to sleep
+		constexpr int IdleRounds = 64;
+
+		std::size_t NextVictim() noexcept
+		{
+			// Xorshift, per thread, so that thieves spread over the victims without sharing state
+			thread_local std::uint32_t state = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1;
+
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+
+			return state;
+		}
+	}
+
+	/// @brief Chase-Lev deque of a worker, as given for C11 atomics by Lê, Pop, Cohen, and Zappa Nardelli, "Correct and
+	/// Efficient Work-Stealing for Weak Memory Models". Only the owner pushes and pops, at the bottom; anyone steals at the top.
+	struct ThreadPool::_Worker
+	{
+		static constexpr std::int64_t Capacity = 1024;
+
+		bool Push(_Task* task) noexcept
+		{
+			std::int64_t bottom = Bottom.load(std::memory_order_relaxed);
+			std::int64_t top = Top.load(std::memory_order_acquire);
+			if (bottom - top >= Capacity)
+				return false;
+
+			// The slot being released as well hands the task over to a thief with no reliance on the fence alone
+			Items[bottom & (Capacity - 1)].store(task, std::memory_order_release);
+			std::atomic_thread_fence(std::memory_order_release);
+			Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		_Task* Pop() noexcept
+		{
+			std::int64_t bottom = Bottom.load(std::memory_order_relaxed) - 1;
+			Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t top = Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			_Task* task = Items[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+
+			// The last task may be wanted by a thief as well, whoever moves the top first gets it
+			if (top == bottom)
+			{
+				if (!Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					task = nullptr;
+
+				Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return task;
+		}
+
+		_Task* Steal() noexcept
+		{
+			std::int64_t top = Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t bottom = Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			_Task* task = Items[top & (Capacity - 1)].load(std::memory_order_acquire);
+			if (!Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return task;
+		}
+
+		ThreadPool* Pool = nullptr;
+
+		alignas(CacheLineSize) std::atomic<std::int64_t> Top = 0;
+		alignas(CacheLineSize) std::atomic<std::int64_t> Bottom = 0;
+		std::atomic<_Task*> Items[Capacity] = {};
+	};
+
+	thread_local ThreadPool::_Worker* ThreadPool::_Current = nullptr;
+
+	ThreadPool::ThreadPool(std::size_t concurrency) : _Concurrency(concurrency ? concurrency : std::max<std::size_t>(std::thread::hardware_concurrency(), 1)),
+		_Workers(std::make_unique<_Worker[]>(_Concurrency - 1)), _Threads(), _Injected(InjectedCapacity), _Epoch(0), _Sleeping(0), _Stopping(false)
+	{
+		for (std::size_t i = 0; i + 1 < _Concurrency; i++)
+			_Workers[i].Pool = this;
+
+		try
+		{
+			for (std::size_t i = 0; i + 1 < _Concurrency; i++)
+				_Threads.Add(std::thread(&ThreadPool::_Run, this, i));
+		}
+		catch (...)
+		{
+			_Stopping.store(true);
+			_Epoch.fetch_add(1);
+			_Epoch.notify_all();
+
+			for (std::thread& thread : _Threads)
+				thread.join();
+
+			throw;
+		}
+	}
+
+	std::size_t ThreadPool::Concurrency() const noexcept
+	{
+		return _Concurrency;
+	}
+
+	ThreadPool& ThreadPool::Default()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		_Stopping.store(true);
+		_Epoch.fetch_add(1);
+		_Epoch.notify_all();
+
+		for (std::thread& thread : _Threads)
+			thread.join();
+	}
+
+	ThreadPool::_Task* ThreadPool::_Find() noexcept
+	{
+		_Task* task = nullptr;
+
+		if (_Current && _Current->Pool == this)
+			task = _Current->Pop();
+
+		if (!task)
+			_Injected.TryDequeue(task);
+
+		if (!task)
+			task = _Steal(NextVictim());
+
+		return task;
+	}
+
+	void ThreadPool::_Join(_Task& task) noexcept
+	{
+		// Unless stolen meanwhile, the task is still the newest on this thread's deque and simply runs here
+		if (_Current && _Current->Pool == this)
+		{
+			if (_Task* top = _Current->Pop())
+			{
+				if (top == &task)
+				{
+					task.Execute(task);
+					return;
+				}
+
+				// The task was stolen, and this is an older one forked by an outer frame of this thread, which may as well run now
+				top->Execute(*top);
+			}
+		}
+
+		while (!task.Done.load(std::memory_order_acquire))
+		{
+			if (_Task* other = _Find())
+				other->Execute(*other);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	bool ThreadPool::_Push(_Task& task) noexcept
+	{
+		bool pushed = (_Current && _Current->Pool == this) ? _Current->Push(&task) : _Injected.TryEnqueue(&task);
+		if (pushed)
+			_Wake();
+
+		return pushed;
+	}
+
+	void ThreadPool::_Run(std::size_t index) noexcept
+	{
+		_Current = &_Workers[index];
+
+		while (!_Stopping.load(std::memory_order_relaxed))
+		{
+			_Task* task = _Find();
+			for (int round = 0; !task && round < IdleRounds; round++)
+			{
+				std::this_thread::yield();
+				task = _Find();
+			}
+
+			if (!task)
+			{
+				// Registering as a sleeper before reading the epoch, and _Wake bumping the epoch before checking for sleepers, lets
+				// either this thread see the new work or _Wake see this thread
+				_Sleeping.fetch_add(1);
+				std::uint32_t epoch = _Epoch.load();
+
+				task = _Find();
+				if (!task && !_Stopping.load())
+					_Epoch.wait(epoch);
+
+				_Sleeping.fetch_sub(1);
+			}
+
+			if (task)
+				task->Execute(*task);
+		}
+
+		_Current = nullptr;
+	}
+
+	ThreadPool::_Task* ThreadPool::_Steal(std::size_t start) noexcept
+	{
+		std::size_t count = _Concurrency - 1;
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			_Worker& victim = _Workers[(start + i) % count];
+			if (&victim == _Current)
+				continue;
+
+			if (_Task* task = victim.Steal())
+				return task;
+		}
+
+		return nullptr;
+	}
+
+	void ThreadPool::_Wake() noexcept
+	{
+		_Epoch.fetch_add(1);
+
+		if (_Sleeping.load() > 0)
+			_Epoch.notify_one();
+	}
+};
\ No newline at end of file
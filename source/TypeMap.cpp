@@ -0,0 +1,42 @@
+#include "TypeMap.hpp"
+
+namespace CQue
+{
+	TypeMap::TypeMap(std::pmr::memory_resource* resource) noexcept : _Slots(), _Count(0), _Resource(resource) {}
+
+	void TypeMap::Clear() noexcept
+	{
+		for (Any& slot : _Slots)
+			slot.Reset();
+
+		_Count = 0;
+	}
+
+	bool TypeMap::Contains(const TypeTag& tag) const
+	{
+		return (Find(tag) != nullptr);
+	}
+
+	std::size_t TypeMap::Count() const noexcept
+	{
+		return _Count;
+	}
+
+	const Any* TypeMap::Find(const TypeTag& tag) const
+	{
+		const Any& slot = _Slots.Find(tag.GetIndex());
+		return !slot.IsEmpty() ? &slot : nullptr;
+	}
+
+	bool TypeMap::Remove(const TypeTag& tag)
+	{
+		std::size_t index = tag.GetIndex();
+		if (_Slots.Find(index).IsEmpty())
+			return false;
+
+		_Slots.At(index).Reset();
+		_Count--;
+
+		return true;
+	}
+};
\ No newline at end of file
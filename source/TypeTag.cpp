@@ -1,9 +1,43 @@
 #include "TypeTag.hpp"
 
+#include <mutex>
+
 namespace CQue
 {
+	namespace
+	{
+		std::mutex& RegistryLock()
+		{
+			static std::mutex lock;
+			return lock;
+		}
+
+		std::atomic<std::size_t> RegisteredTypes = 0;
+	}
+
 	std::uint64_t TypeTag::GetID() const noexcept
 	{
 		return (std::uint64_t) this;
 	}
+
+	std::size_t TypeTag::RegisteredCount() noexcept
+	{
+		return RegisteredTypes.load(std::memory_order_acquire);
+	}
+
+	std::size_t TypeTag::_Register() const
+	{
+		// Indices are handed out under the lock so that racing first uses of the same type cannot skip a number
+		std::lock_guard<std::mutex> guard(RegistryLock());
+
+		std::size_t index = _ptrIndex->load(std::memory_order_relaxed);
+		if (index == _Unregistered)
+		{
+			index = RegisteredTypes.load(std::memory_order_relaxed);
+			_ptrIndex->store(index, std::memory_order_release);
+			RegisteredTypes.store(index + 1, std::memory_order_release);
+		}
+
+		return index;
+	}
 };
\ No newline at end of file